@@ -0,0 +1,122 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Commandlets/DroneHeightFieldBakeCommandlet.h"
+
+#include "Data/DroneHeightField.h"
+#include "Engine/LevelBounds.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+
+UDroneHeightFieldBakeCommandlet::UDroneHeightFieldBakeCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UDroneHeightFieldBakeCommandlet::Main(const FString& Params)
+{
+	FString MapPackageName = TEXT("/Game/Maps/MainMap");
+	float CellSize = 100.f;
+	int32 TileCells = 64;
+
+	FParse::Value(*Params, TEXT("Map="), MapPackageName);
+	FParse::Value(*Params, TEXT("CellSize="), CellSize);
+	FParse::Value(*Params, TEXT("TileCells="), TileCells);
+
+	if (CellSize <= 0.f || TileCells < 2)
+	{
+		UE_LOG(LogTemp, Error, TEXT("DroneHeightFieldBake: invalid CellSize/TileCells"));
+		return 1;
+	}
+
+	UPackage* MapPackage = LoadPackage(nullptr, *MapPackageName, LOAD_None);
+	UWorld* World = MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+	if (!World)
+	{
+		UE_LOG(LogTemp, Error, TEXT("DroneHeightFieldBake: failed to load %s"), *MapPackageName);
+		return 1;
+	}
+
+	// 트레이스용 물리 씬만 있는 최소 월드 초기화
+	World->AddToRoot();
+	if (!World->bIsWorldInitialized)
+	{
+		UWorld::InitializationValues InitValues;
+		InitValues.InitializeScenes(false).AllowAudioPlayback(false).RequiresHitProxies(false)
+			.CreatePhysicsScene(true).CreateNavigation(false).CreateAISystem(false)
+			.ShouldSimulatePhysics(false).EnableTraceCollision(true).SetTransactional(false);
+		World->InitWorld(InitValues);
+	}
+	World->UpdateWorldComponents(true, false);
+
+	const FBox LevelBounds = ALevelBounds::CalculateLevelBounds(World->PersistentLevel);
+	if (!LevelBounds.IsValid)
+	{
+		UE_LOG(LogTemp, Error, TEXT("DroneHeightFieldBake: %s has no level bounds"), *MapPackageName);
+		World->RemoveFromRoot();
+		return 1;
+	}
+
+	// 샘플 격자가 레벨 전체를 덮도록 타일 수 결정
+	const int32 NumSamplesX = FMath::CeilToInt32(LevelBounds.GetSize().X / CellSize) + 1;
+	const int32 NumSamplesY = FMath::CeilToInt32(LevelBounds.GetSize().Y / CellSize) + 1;
+
+	FDroneHeightFieldHeader Header;
+	Header.OriginX = LevelBounds.Min.X;
+	Header.OriginY = LevelBounds.Min.Y;
+	Header.CellSize = CellSize;
+	Header.TileCells = TileCells;
+	Header.NumTilesX = FMath::DivideAndRoundUp(NumSamplesX, TileCells);
+	Header.NumTilesY = FMath::DivideAndRoundUp(NumSamplesY, TileCells);
+
+	const double TraceTopZ = LevelBounds.Max.Z + 100.0;
+	const double TraceBottomZ = LevelBounds.Min.Z - 100.0;
+	const int64 TileStride = static_cast<int64>(TileCells) * TileCells;
+
+	TArray<float> Heights;
+	Heights.SetNumUninitialized(static_cast<int64>(Header.NumTilesX) * Header.NumTilesY * TileStride);
+
+	int32 NumInvalid = 0;
+	for (int32 TileY = 0; TileY < Header.NumTilesY; ++TileY)
+	{
+		for (int32 TileX = 0; TileX < Header.NumTilesX; ++TileX)
+		{
+			const int64 TileBase = (static_cast<int64>(TileY) * Header.NumTilesX + TileX) * TileStride;
+			for (int32 LocalY = 0; LocalY < TileCells; ++LocalY)
+			{
+				for (int32 LocalX = 0; LocalX < TileCells; ++LocalX)
+				{
+					const int32 SampleX = TileX * TileCells + LocalX;
+					const int32 SampleY = TileY * TileCells + LocalY;
+					const double X = Header.OriginX + SampleX * static_cast<double>(CellSize);
+					const double Y = Header.OriginY + SampleY * static_cast<double>(CellSize);
+
+					FHitResult Hit;
+					const bool bHit = World->LineTraceSingleByChannel(Hit, FVector(X, Y, TraceTopZ), FVector(X, Y, TraceBottomZ), ECC_Visibility);
+
+					// 움직이는 지오메트리 위나 지면이 없는 곳은 런타임 트레이스로 대체
+					const bool bStatic = bHit && Hit.GetComponent() && Hit.GetComponent()->Mobility != EComponentMobility::Movable;
+					Heights[TileBase + LocalY * TileCells + LocalX] = bStatic ? static_cast<float>(Hit.ImpactPoint.Z) : FDroneHeightField::InvalidHeight;
+					NumInvalid += bStatic ? 0 : 1;
+				}
+			}
+		}
+	}
+
+	World->RemoveFromRoot();
+
+	const FString Filename = FDroneHeightField::GetHeightFieldPath(MapPackageName);
+	if (!FDroneHeightField::Save(Filename, Header, Heights))
+	{
+		UE_LOG(LogTemp, Error, TEXT("DroneHeightFieldBake: failed to write %s"), *Filename);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("DroneHeightFieldBake: wrote %s (%dx%d tiles, %d samples, %d fallback)"),
+		*Filename, Header.NumTilesX, Header.NumTilesY, Heights.Num(), NumInvalid);
+	return 0;
+}
@@ -1,7 +1,9 @@
 #include "Components/Camera/DroneCameraComponent.h"
 
+#include "DroneStats.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Subsystems/DroneFleetPerfSubsystem.h"
 
 UDroneCameraComponent::UDroneCameraComponent()
 {
@@ -30,10 +32,20 @@ void UDroneCameraComponent::BeginPlay()
     }
 }
 
+void UDroneCameraComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // 보간 중에 제거되어도 활성 보간 카운터가 남지 않게 한다
+    SetInterpolationActive(false);
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void UDroneCameraComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+    DRONE_FLEET_PERF_SCOPE(CameraCycles);
+
     if (bShouldInterpCamera)
     {
         UpdateCameraInterpolation(DeltaTime);
@@ -61,9 +73,16 @@ void UDroneCameraComponent::StartCameraInterpolation(const float TargetPitch, co
 {
     TargetCameraPitch = TargetPitch;
     TargetCameraRoll = TargetRoll;
-    bShouldInterpCamera = true;
 
-    SetComponentTickEnabled(true);
+    // 카메라 갱신이 꺼져 있으면 보간 없이 목표값만 기록 (다시 켜질 때 반영)
+    if (!bCameraUpdatesEnabled)
+    {
+        CurrentCameraPitch = TargetPitch;
+        CurrentCameraRoll = TargetRoll;
+        return;
+    }
+
+    SetInterpolationActive(true);
 }
 
 void UDroneCameraComponent::UpdateCameraInterpolation(float DeltaTime)
@@ -73,6 +92,8 @@ void UDroneCameraComponent::UpdateCameraInterpolation(float DeltaTime)
         return;
     }
 
+    DRONE_SCOPE_CYCLE_COUNTER(STAT_DroneCameraInterp, CameraInterp);
+
     // 보간 수행
     CurrentCameraPitch = FMath::FInterpTo(CurrentCameraPitch, TargetCameraPitch, DeltaTime, CameraPitchInterpSpeed);
     CurrentCameraRoll = FMath::FInterpTo(CurrentCameraRoll, TargetCameraRoll, DeltaTime, CameraRollInterpSpeed);
@@ -88,19 +109,15 @@ void UDroneCameraComponent::UpdateCameraInterpolation(float DeltaTime)
         CurrentCameraRoll = TargetCameraRoll;
         ApplyCameraRotation();
 
-        bShouldInterpCamera = false;
-
         // Tick 자동 비활성화
-        SetComponentTickEnabled(false);
+        SetInterpolationActive(false);
     }
 }
 
 void UDroneCameraComponent::StopCameraInterpolation()
 {
-    bShouldInterpCamera = false;
-
     // Tick 비활성화
-    SetComponentTickEnabled(false);
+    SetInterpolationActive(false);
 
     UE_LOG(LogTemp, Log, TEXT("Camera interpolation stopped"));
 }
@@ -140,6 +157,12 @@ void UDroneCameraComponent::HandleLandingTransition(const FRotator& CurrentPawnR
 {
     if (!CameraBoom) return;
 
+    if (!bCameraUpdatesEnabled)
+    {
+        StartCameraInterpolation(0.f, 0.f);
+        return;
+    }
+
     const FRotator CurrentCameraRelativeRotation = CameraBoom->GetRelativeRotation();
     const FRotator WorldCameraRotation = UKismetMathLibrary::ComposeRotators(CurrentPawnRotation, CurrentCameraRelativeRotation);
 
@@ -153,6 +176,55 @@ void UDroneCameraComponent::HandleLandingTransition(const FRotator& CurrentPawnR
     ApplyCameraRotation();
 }
 
+void UDroneCameraComponent::SetCameraUpdatesEnabled(bool bEnabled)
+{
+    if (bCameraUpdatesEnabled == bEnabled)
+    {
+        return;
+    }
+    bCameraUpdatesEnabled = bEnabled;
+
+    if (!bEnabled)
+    {
+        // 진행 중인 보간은 목표값으로 바로 끝낸다
+        if (bShouldInterpCamera)
+        {
+            CurrentCameraPitch = TargetCameraPitch;
+            CurrentCameraRoll = TargetCameraRoll;
+            SetInterpolationActive(false);
+        }
+    }
+    else
+    {
+        // 꺼져 있는 동안 기록된 상태를 반영
+        ApplyCameraRotation();
+    }
+
+    if (CameraBoom)
+    {
+        CameraBoom->SetComponentTickEnabled(bEnabled);
+    }
+}
+
+void UDroneCameraComponent::SetInterpolationActive(bool bActive)
+{
+    if (bShouldInterpCamera != bActive)
+    {
+        bShouldInterpCamera = bActive;
+
+        if (bActive)
+        {
+            INC_DWORD_STAT(STAT_DroneActiveCameraInterps);
+        }
+        else
+        {
+            DEC_DWORD_STAT(STAT_DroneActiveCameraInterps);
+        }
+    }
+
+    SetComponentTickEnabled(bActive);
+}
+
 void UDroneCameraComponent::ApplyCameraRotation()
 {
     if (CameraBoom)
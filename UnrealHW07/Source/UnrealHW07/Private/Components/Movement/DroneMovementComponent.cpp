@@ -1,11 +1,122 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Components/Movement/DroneMovementComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "DroneStats.h"
+#include "Data/DroneHeightField.h"
 #include "GameFramework/Pawn.h"
+#include "Net/UnrealNetwork.h"
+#include "Physics/DroneAsyncPhysicsCallback.h"
+#include "Physics/DroneKinematics.h"
+#include "Subsystems/DroneAvoidanceSubsystem.h"
+#include "Subsystems/DroneHeightFieldSubsystem.h"
+#include "Subsystems/DroneInputLatencySubsystem.h"
+#include "Subsystems/DroneFleetPerfSubsystem.h"
+#include "Subsystems/DroneFlightRecorderSubsystem.h"
+#include "Subsystems/DroneMovementSubsystem.h"
+#include "Subsystems/DroneRewindSubsystem.h"
+#include "Subsystems/DroneSignificanceSubsystem.h"
+
+// 단계 전환/히치 후 한 번에 따라잡는 최대 시간
+static constexpr float MaxSimCatchUpTime = 1.f;
+
+static TAutoConsoleVariable<bool> CVarDroneValidateHeightField(
+	TEXT("drone.HeightField.Validate"),
+	false,
+	TEXT("Compare every baked height field sample against LineTraceSingleByChannel and log mismatches."));
+
+static TAutoConsoleVariable<float> CVarDroneHeightFieldTolerance(
+	TEXT("drone.HeightField.ValidateTolerance"),
+	10.f,
+	TEXT("Allowed ground distance error (cm) when validating the baked height field."));
+
+static TAutoConsoleVariable<bool> CVarDroneNetLogCorrections(
+	TEXT("drone.Net.LogCorrections"),
+	false,
+	TEXT("Log every client prediction correction with the predicted and server states."));
+
+FDroneNetMove FDroneNetMove::FromCommand(const FDroneInputCommand& Command, uint32 InMoveId, float InDeltaTime)
+{
+	FDroneNetMove NetMove;
+	NetMove.MoveId = InMoveId;
+	NetMove.DeltaTime = InDeltaTime;
+	NetMove.Move = Command.Move;
+	NetMove.Look = Command.Look;
+	NetMove.Thrust = Command.Thrust;
+	NetMove.Roll = Command.Roll;
+	NetMove.bElevating = Command.bElevating;
+	NetMove.bVelocityReset = Command.bVelocityReset;
+	return NetMove;
+}
+
+bool FDroneNetState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// 확인 상태는 드론별 설정을 알 수 없으므로 전체 회전 범위의 기본 양자화 설정을 쓴다
+	static const FDroneStateQuantization AckQuantization;
+
+	Ar.SerializeIntPacked(MoveId);
+
+	// 양자화 범위를 벗어나면 경계로 잘려 매번 보정이 나므로, 그때만 전체 정밀도로 보낸다
+	uint8 bFullPrecision = 0;
+	if (Ar.IsSaving())
+	{
+		bFullPrecision = FMath::Abs(Location.X) > AckQuantization.PositionExtent
+			|| FMath::Abs(Location.Y) > AckQuantization.PositionExtent
+			|| FMath::Abs(Location.Z) > AckQuantization.PositionExtent
+			|| !AckQuantization.VelocityRange.Contains(ZVelocity);
+	}
+	Ar.SerializeBits(&bFullPrecision, 1);
+
+	if (bFullPrecision)
+	{
+		Ar << Location;
+		Ar << Rotation;
+		Ar << ZVelocity;
+		Ar << MovementMode;
+	}
+	else
+	{
+		FDroneQuantizedState Quantized;
+		if (Ar.IsSaving())
+		{
+			Quantized = DroneStateCodec::Quantize(Location, Rotation, ZVelocity, MovementMode, AckQuantization);
+			DroneStateCodec::WriteFull(Ar, Quantized, AckQuantization);
+		}
+		else
+		{
+			DroneStateCodec::ReadFull(Ar, Quantized, AckQuantization);
+			DroneStateCodec::Dequantize(Quantized, AckQuantization, Location, Rotation, ZVelocity, MovementMode);
+		}
+	}
+
+	// 고정 스텝 상태는 재시뮬레이션 경계를 정하므로 양자화하지 않는다
+	Ar << FixedStepAccumulator;
+	Ar << InterpolationAlpha;
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+FDroneInputCommand FDroneNetMove::ToCommand() const
+{
+	// 클라이언트가 보낸 값이므로 입력 축 범위를 다시 제한한다
+	FDroneInputCommand Command;
+	Command.Move = FVector2D(FMath::Clamp(Move.X, -1.f, 1.f), FMath::Clamp(Move.Y, -1.f, 1.f));
+	Command.Look = Look;
+	Command.Thrust = FMath::Clamp(Thrust, -1.f, 1.f);
+	Command.Roll = FMath::Clamp(Roll, -1.f, 1.f);
+	Command.bElevating = bElevating;
+	Command.bVelocityReset = bVelocityReset;
+	return Command;
+}
 
 UDroneMovementComponent::UDroneMovementComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
+	SetIsReplicatedByDefault(true);
+
+	// 복제 양자화 설정은 첫 복제 데이터를 받기 전에 InitializeComponent 에서 정한다
+	bWantsInitializeComponent = true;
 
 	// 기본값 설정
 	MovementMode = EDroneMovementMode::Grounded;
@@ -19,6 +130,14 @@ UDroneMovementComponent::UDroneMovementComponent()
 	MoveSpeed = 800.f;
 }
 
+void UDroneMovementComponent::InitializeComponent()
+{
+	Super::InitializeComponent();
+
+	// 클라이언트는 BeginPlay 전에 첫 복제 데이터를 읽으므로 여기서 양자화 설정을 맞춘다
+	RefreshStateQuantization();
+}
+
 void UDroneMovementComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -27,24 +146,150 @@ void UDroneMovementComponent::BeginPlay()
 	{
 		UE_LOG(LogTemp, Warning, TEXT("DroneMovementComponent: PawnOwner is null!"));
 	}
+
+	if (bUseBakedHeightField)
+	{
+		if (const UDroneHeightFieldSubsystem* HeightFieldSubsystem = UWorld::GetSubsystem<UDroneHeightFieldSubsystem>(GetWorld()))
+		{
+			HeightField = HeightFieldSubsystem->GetHeightField();
+		}
+	}
+
+	// 배치/비동기 물리 모드: 서브시스템에 등록되면 개별 Tick 은 끈다 (네트워크 게임은 무브 단위로 시뮬레이션해야 하므로 제외)
+	if (TickMode != EDroneMovementTickMode::PerComponent && GetNetMode() == NM_Standalone)
+	{
+		if (UDroneMovementSubsystem* MovementSubsystem = UWorld::GetSubsystem<UDroneMovementSubsystem>(GetWorld()))
+		{
+			if (TickMode == EDroneMovementTickMode::AsyncPhysics)
+			{
+				MovementSubsystem->RegisterAsyncPhysicsDrone(this);
+			}
+
+			// 비동기 물리를 쓸 수 없으면 배치 모드로 대체
+			if (!IsAsyncPhysics())
+			{
+				MovementSubsystem->RegisterDrone(this);
+			}
+
+			SetComponentTickEnabled(!IsBatched() && !IsAsyncPhysics());
+		}
+	}
+
+	if (UDroneSignificanceSubsystem* SignificanceSubsystem = UWorld::GetSubsystem<UDroneSignificanceSubsystem>(GetWorld()))
+	{
+		SignificanceSubsystem->RegisterDrone(this);
+	}
+
+	// 지연 보상 기록은 서버에서만
+	if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
+	{
+		if (UDroneRewindSubsystem* RewindSubsystem = UWorld::GetSubsystem<UDroneRewindSubsystem>(GetWorld()))
+		{
+			RewindSubsystem->RegisterDrone(this);
+		}
+	}
+
+	// 회피 조향과 드론 간 스윕 무시는 클라이언트를 뺀 곳에서만 (클라이언트 드론은 항상 다른 드론에 막힌다)
+	if (UDroneAvoidanceSubsystem* AvoidanceSubsystem = UWorld::GetSubsystem<UDroneAvoidanceSubsystem>(GetWorld()))
+	{
+		if (!IsNetMode(NM_Client))
+		{
+			AvoidanceSubsystem->RegisterDrone(this);
+		}
+	}
+
+	FlightRecorder = UWorld::GetSubsystem<UDroneFlightRecorderSubsystem>(GetWorld());
+}
+
+void UDroneMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindSleepWakeEvents();
+	bIsSleeping = false;
+
+	if (UDroneSignificanceSubsystem* SignificanceSubsystem = UWorld::GetSubsystem<UDroneSignificanceSubsystem>(GetWorld()))
+	{
+		SignificanceSubsystem->UnregisterDrone(this);
+	}
+
+	if (UDroneRewindSubsystem* RewindSubsystem = UWorld::GetSubsystem<UDroneRewindSubsystem>(GetWorld()))
+	{
+		RewindSubsystem->UnregisterDrone(this);
+	}
+
+	if (UDroneAvoidanceSubsystem* AvoidanceSubsystem = UWorld::GetSubsystem<UDroneAvoidanceSubsystem>(GetWorld()))
+	{
+		AvoidanceSubsystem->UnregisterDrone(this);
+	}
+
+	if (FlightRecorder && FlightRecorder->IsRecording())
+	{
+		FlightRecorder->RecordDespawn(this);
+	}
+
+	if (IsBatched() || IsAsyncPhysics())
+	{
+		if (UDroneMovementSubsystem* MovementSubsystem = UWorld::GetSubsystem<UDroneMovementSubsystem>(GetWorld()))
+		{
+			MovementSubsystem->UnregisterDrone(this);
+			MovementSubsystem->UnregisterAsyncPhysicsDrone(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UDroneMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (!PawnOwner || !UpdatedComponent)
+	DRONE_SCOPE_CYCLE_COUNTER(STAT_DroneMovementTick, MovementTick);
+	DRONE_FLEET_PERF_SCOPE(MovementCycles);
+
+	if (!CanSimulate() || !ShouldSimulateLocally())
+	{
+		return;
+	}
+
+	// 갱신 간격이 늘어난 드론은 지난 갱신 이후의 시간 전체를 적분
+	const float SimDeltaTime = ConsumeSimElapsedTime(DeltaTime);
+
+	if (!IsNetPredicting())
 	{
+		SimulateFrame(SimDeltaTime);
 		return;
 	}
 
+	// 조종 중인 클라이언트: 소비 전 입력을 무브로 남기고 예측 시뮬레이션 후 서버로 보낸다
+	// 서버가 무브 시간을 자르는 것과 같은 값으로 먼저 잘라야 히치 프레임에서도 예측이 맞는다
+	const float MoveDeltaTime = FMath::Min(SimDeltaTime, MaxNetMoveDeltaTime);
+	const FDroneNetMove Move = FDroneNetMove::FromCommand(InputCommand, NextNetMoveId++, MoveDeltaTime);
+	SimulateFrame(MoveDeltaTime);
+	SavePredictedMove(Move);
+}
+
+void UDroneMovementComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// 조종 중인 클라이언트는 ClientAckMove 로 이동 상태를 보정받는다
+	DOREPLIFETIME_CONDITION(UDroneMovementComponent, ReplicatedState, COND_SimulatedOnly);
+}
+
+void UDroneMovementComponent::SimulateFrame(float DeltaTime)
+{
+	ConsumeInputCommand(DeltaTime);
 	PerformGroundTrace();
 
-	if (ShouldApplyPhysics())
+	float StepDeltaTime = 0.f;
+	const int32 NumSteps = AdvanceSimClock(DeltaTime, StepDeltaTime);
+
+	const float OffsetZ = SimulateSteps(NumSteps, StepDeltaTime);
+	if (OffsetZ != 0.f)
 	{
-		ApplyGravity(DeltaTime);
-		ApplyVerticalMovement(DeltaTime);
+		QueueVerticalOffset(OffsetZ);
 	}
+
+	FinishSimFrame(NumSteps * StepDeltaTime);
 }
 
 bool UDroneMovementComponent::IsMoveInputIgnored() const
@@ -60,56 +305,220 @@ void UDroneMovementComponent::AddInputVector(FVector WorldVector, bool bForce)
 	}
 }
 
+FDroneInputCommand& UDroneMovementComponent::EditInputCommand()
+{
+#if DRONE_STATS
+	// 이번 프레임 첫 샘플 시각을 기록 (입력 → 반영 지연 측정 기준)
+	if (InputCommand.SampleTime == 0.0)
+	{
+		InputCommand.SampleTime = FPlatformTime::Seconds();
+	}
+#endif
+	WakeUp();
+	return InputCommand;
+}
+
+void UDroneMovementComponent::SetFlightInputSettings(float SpeedMultiplier, float InRollSpeed, const FFloatInterval& PitchRange, const FFloatInterval& RollRange)
+{
+	FlyingSpeedMultiplier = SpeedMultiplier;
+	RollSpeed = InRollSpeed;
+	FlyingPitchRange = PitchRange;
+	FlyingRollRange = RollRange;
+
+	RefreshStateQuantization();
+}
+
+void UDroneMovementComponent::RefreshStateQuantization()
+{
+	// 비행 중 피치/롤은 비행 범위 안이므로 그 범위만 양자화한다.
+	// 보내는 쪽과 받는 쪽 비트 수가 같아야 하므로 폰이 PostInitializeComponents 에서 범위를 넘기고, 이후에는 바꾸지 않는다
+	ReplicatedState.Quantization = StateQuantization;
+	ReplicatedState.Quantization.PitchRange = FlyingPitchRange;
+	ReplicatedState.Quantization.RollRange = FlyingRollRange;
+}
+
+void UDroneMovementComponent::ConsumeInputCommand(float DeltaTime)
+{
+	const FDroneInputCommand& Command = InputCommand;
+
+	// 개별 Tick 과 배치 경로가 모두 지나는 곳에서 기록한다 (보정 재시뮬레이션은 기록하지 않고 결과 상태는 RecordReset 으로 남김)
+	bRecordingFrame = FlightRecorder && FlightRecorder->IsRecording() && !bSuppressModeEvents;
+	if (bRecordingFrame)
+	{
+		// 비동기 물리 드론은 물리 스레드에서 적분하므로 재생할 수 없다
+		if (IsAsyncPhysics())
+		{
+			FlightRecorder->RecordSkipped(this);
+			bRecordingFrame = false;
+		}
+		else
+		{
+			FlightRecorder->RecordFrame(this, Command, DeltaTime, SimCatchUpTime);
+		}
+	}
+
+#if DRONE_STATS
+	// 고정 스텝/추력은 다음 프레임에야 움직일 수 있으므로 실제 커밋까지 가장 오래된 입력 시각을 들고 간다
+	if (PendingLatencySampleTime == 0.0 && Command.HasFrameInput())
+	{
+		PendingLatencySampleTime = Command.SampleTime;
+	}
+#endif
+
+	// 상승 상태/속도 리셋이 먼저 반영되어야 같은 프레임의 추력과 지면 판정이 맞는다
+	SetElevatingState(Command.bElevating);
+	if (Command.bVelocityReset)
+	{
+		ApplyVelocityReset(1.f);
+	}
+
+	AddThrust(Command.Thrust, DeltaTime);
+
+	const float SpeedMultiplier = IsFlight() ? FlyingSpeedMultiplier : 1.0f;
+	AddMovementInput(Command.Move, DeltaTime, SpeedMultiplier);
+
+	if (!Command.Look.IsNearlyZero())
+	{
+		if (IsGrounded())
+		{
+			AddYawInput(Command.Look.X);
+
+			// 보정 재시뮬레이션 중에는 이미 반영한 카메라 피치를 다시 보내지 않는다
+			if (!bSuppressModeEvents && !FMath::IsNearlyZero(Command.Look.Y))
+			{
+				OnGroundLookPitch.Broadcast(Command.Look.Y);
+			}
+		}
+		else
+		{
+			AddRotationInput(Command.Look.X, Command.Look.Y, 0.f, FlyingPitchRange, FlyingRollRange);
+		}
+	}
+
+	if (IsFlight() && !FMath::IsNearlyZero(Command.Roll))
+	{
+		AddRotationInput(0.f, 0.f, Command.Roll * RollSpeed * DeltaTime, FlyingPitchRange, FlyingRollRange);
+	}
+
+	LastInputCommand = InputCommand;
+	InputCommand.ClearFrameInput();
+}
+
 void UDroneMovementComponent::AddMovementInput(const FVector2D& InputValue, float DeltaTime, float SpeedMultiplier)
 {
 	if (!PawnOwner || InputValue.IsNearlyZero()) return;
 
+	WakeUp();
+
+	// 고정 스텝 모드에서는 입력만 기록하고 시뮬레이션된 시간만큼 이동
+	if (bUseFixedTimestep)
+	{
+		PendingMoveInput = InputValue * SpeedMultiplier;
+		return;
+	}
+
+	QueueMovementOffset(InputValue * SpeedMultiplier, DeltaTime);
+}
+
+FVector UDroneMovementComponent::QueueMovementOffset(const FVector2D& ScaledInput, float DeltaTime)
+{
 	const FVector LocalOffset(
-		InputValue.Y * MoveSpeed * SpeedMultiplier * DeltaTime,
-		InputValue.X * MoveSpeed * SpeedMultiplier * DeltaTime,
+		ScaledInput.Y * MoveSpeed * DeltaTime,
+		ScaledInput.X * MoveSpeed * DeltaTime,
 		0.f
 	);
 
-	PawnOwner->AddActorLocalOffset(LocalOffset, true);
+	const FVector WorldOffset = GetPendingRotation().RotateVector(LocalOffset);
+	PendingTranslation += WorldOffset;
+	return WorldOffset;
 }
 
 void UDroneMovementComponent::AddRotationInput(float YawDelta, float PitchDelta, float RollDelta, const FFloatInterval& PitchRange, const FFloatInterval& RollRange)
 {
 	if (!PawnOwner) return;
 
-	const FRotator CurrentRotation = PawnOwner->GetActorRotation();
+	QueueRotation(DroneKinematics::ClampFlightRotation(GetPendingRotation(), YawDelta, PitchDelta, RollDelta, PitchRange, RollRange));
+}
+
+void UDroneMovementComponent::AddYawInput(float YawDelta)
+{
+	if (!PawnOwner) return;
+
+	const FQuat YawQuat(FRotator(0.f, YawDelta, 0.f));
+	QueueRotation((GetPendingRotation().Quaternion() * YawQuat).Rotator());
+}
 
-	float NewYaw = CurrentRotation.Yaw + YawDelta;
-	float NewPitch = FMath::Clamp(CurrentRotation.Pitch + PitchDelta, PitchRange.Min, PitchRange.Max);
-	float NewRoll = FMath::Clamp(CurrentRotation.Roll + RollDelta, RollRange.Min, RollRange.Max);
+void UDroneMovementComponent::QueueRotation(const FRotator& NewRotation)
+{
+	PendingRotation = NewRotation;
+	bHasPendingRotation = true;
+	WakeUp();
+}
 
-	PawnOwner->SetActorRotation(FRotator(NewPitch, NewYaw, NewRoll));
+FRotator UDroneMovementComponent::GetPendingRotation() const
+{
+	if (bHasPendingRotation)
+	{
+		return PendingRotation;
+	}
+	return UpdatedComponent ? UpdatedComponent->GetComponentRotation() : FRotator::ZeroRotator;
 }
 
 void UDroneMovementComponent::AddThrust(float ThrustInput, float DeltaTime)
 {
 	if (FMath::IsNearlyZero(ThrustInput)) return;
 
-	const float Accel = ThrustInput * ThrustAccelZ * DeltaTime;
-	CurrentZVelocity += Accel;
-	CurrentZVelocity = FMath::Clamp(CurrentZVelocity, MaxFallingSpeed, MaxAscendingSpeed);
+	WakeUp();
+
+	// 고정 스텝/비동기 물리 모드에서는 입력 축만 기록하고 스텝마다 적분
+	if (bUseFixedTimestep || IsAsyncPhysics())
+	{
+		ThrustAxis = ThrustInput;
+		return;
+	}
+
+	// 배치 모드에서는 서브시스템이 다음 적분 때 한 번에 반영
+	if (IsBatched())
+	{
+		PendingThrust += ThrustInput * DeltaTime;
+		return;
+	}
+
+	DroneKinematics::ApplyThrust(CurrentZVelocity, ThrustInput * DeltaTime, GetKinematicsParams());
 }
 
 void UDroneMovementComponent::ResetVerticalVelocity()
 {
 	CurrentZVelocity = 0.f;
+	PendingThrust = 0.f;
+	ThrustAxis = 0.f;
+	MarkVelocityOverride();
 }
 
 void UDroneMovementComponent::SetVerticalVelocity(float NewVelocity)
 {
 	CurrentZVelocity = NewVelocity;
+	PendingThrust = 0.f;
+	ThrustAxis = 0.f;
+	MarkVelocityOverride();
+	InvalidateGroundTraceSchedule();
+	WakeUp();
 }
 
 void UDroneMovementComponent::ApplyVelocityReset(float InputValue)
 {
-	if (CurrentZVelocity < 0.f && InputValue > 0.f)
+	if (DroneKinematics::ApplyVelocityReset(CurrentZVelocity, InputValue, GetKinematicsParams()))
+	{
+		MarkVelocityOverride();
+	}
+}
+
+void UDroneMovementComponent::MarkVelocityOverride()
+{
+	// 물리 스레드에 덮어쓸 속도를 넘기는 용도이므로 다른 모드에서는 남기지 않는다 (남으면 잠들지 못한다)
+	if (IsAsyncPhysics())
 	{
-		CurrentZVelocity = FMath::Max(CurrentZVelocity, VelocityResetThreshold);
+		bVelocityOverridePending = true;
 	}
 }
 
@@ -118,29 +527,45 @@ void UDroneMovementComponent::SetMovementMode(EDroneMovementMode NewMode)
 	if (MovementMode != NewMode)
 	{
 		MovementMode = NewMode;
+		DRONE_INC_COUNTER(STAT_DroneModeTransitions, ModeTransitions);
 
-		// 상태 변경 시 델리게이트 호출
 		if (MovementMode == EDroneMovementMode::Grounded)
 		{
 			ResetVerticalVelocity();
-			OnLanded.Broadcast();
 		}
-		else if (MovementMode == EDroneMovementMode::Flying)
+
+		// 상태 변경 시 델리게이트 호출
+		if (!bSuppressModeEvents)
 		{
-			OnFlying.Broadcast();
+			BroadcastMovementModeChanged();
 		}
 	}
 }
 
-void UDroneMovementComponent::UpdateMovementState(bool bOnLanded)
+void UDroneMovementComponent::BroadcastMovementModeChanged()
 {
-	if (bOnLanded && MovementMode != EDroneMovementMode::Grounded && !bIsElevating)
+	if (MovementMode == EDroneMovementMode::Grounded)
 	{
-		SetMovementMode(EDroneMovementMode::Grounded);
+		OnLanded.Broadcast();
+	}
+	else if (MovementMode == EDroneMovementMode::Flying)
+	{
+		OnFlying.Broadcast();
 	}
-	else if (((!bOnLanded) || bIsElevating) && MovementMode == EDroneMovementMode::Grounded)
+}
+
+void UDroneMovementComponent::UpdateMovementState(bool bOnLanded)
+{
+	switch (DroneKinematics::ResolveTransition(MovementMode != EDroneMovementMode::Grounded, bOnLanded, bIsElevating))
 	{
+	case EDroneKinematicsTransition::Land:
+		SetMovementMode(EDroneMovementMode::Grounded);
+		break;
+	case EDroneKinematicsTransition::TakeOff:
 		SetMovementMode(EDroneMovementMode::Flying);
+		break;
+	default:
+		break;
 	}
 }
 
@@ -154,38 +579,988 @@ bool UDroneMovementComponent::ShouldApplyPhysics() const
 	return MovementMode == EDroneMovementMode::Flying;
 }
 
-void UDroneMovementComponent::ApplyGravity(float DeltaTime)
+bool UDroneMovementComponent::CanSimulate() const
 {
-	// 뉴턴의 운동 법칙 적용
-	CurrentZVelocity += GravityZ * DeltaTime;
-	CurrentZVelocity = FMath::Max(CurrentZVelocity, MaxFallingSpeed);
+	return PawnOwner && UpdatedComponent && !bIsPooled;
 }
 
-void UDroneMovementComponent::ApplyVerticalMovement(float DeltaTime)
+FDroneKinematicsParams UDroneMovementComponent::GetKinematicsParams() const
 {
-	if (!PawnOwner) return;
+	FDroneKinematicsParams Params;
+	Params.GravityZ = GravityZ;
+	Params.MaxFallingSpeed = MaxFallingSpeed;
+	Params.MaxAscendingSpeed = MaxAscendingSpeed;
+	Params.ThrustAccelZ = ThrustAccelZ;
+	Params.VelocityResetThreshold = VelocityResetThreshold;
+	return Params;
+}
 
-	const FVector ZOffset(0.f, 0.f, CurrentZVelocity * DeltaTime);
-	PawnOwner->AddActorWorldOffset(ZOffset, true);
+void UDroneMovementComponent::ApplyGravity(float DeltaTime)
+{
+	DroneKinematics::ApplyGravity(CurrentZVelocity, DeltaTime, GetKinematicsParams());
 }
 
-void UDroneMovementComponent::SetGroundDetectionSettings(float Offset, float InSphereRadius)
+void UDroneMovementComponent::QueueVerticalOffset(float OffsetZ)
 {
-	GroundDetectionOffset = Offset;
-	SphereRadius = InSphereRadius;
+	PendingTranslation.Z += OffsetZ;
 }
 
-void UDroneMovementComponent::PerformGroundTrace()
+void UDroneMovementComponent::CommitPendingMove()
 {
-	if (!PawnOwner) return;
+	if (!UpdatedComponent || (!bHasPendingRotation && PendingTranslation.IsNearlyZero()))
+	{
+		return;
+	}
 
-	const float TraceLen = GroundDetectionOffset + SphereRadius;
-	const FVector Start = PawnOwner->GetActorLocation();
-	const FVector End = Start - FVector(0, 0, TraceLen);
+	DRONE_SCOPE_CYCLE_COUNTER(STAT_DroneCommitMove, CommitMove);
+
+	const FVector Delta = PendingTranslation;
+	const FQuat NewRotation = bHasPendingRotation ? PendingRotation.Quaternion() : UpdatedComponent->GetComponentQuat();
 
+	PendingTranslation = FVector::ZeroVector;
+	bHasPendingRotation = false;
+
+	// 한 프레임의 이동/회전을 한 번의 스윕으로 반영하고, 막히면 남은 이동량은 표면을 따라 미끄러진다
 	FHitResult Hit;
-	bool bOnLanded = PawnOwner->GetWorld()->LineTraceSingleByChannel(Hit, Start, End, ECC_Visibility);
+	SafeMoveUpdatedComponent(Delta, NewRotation, true, Hit);
+	DRONE_INC_COUNTER(STAT_DroneSweeps, Sweeps);
+
+	if (Hit.IsValidBlockingHit())
+	{
+		DRONE_INC_COUNTER(STAT_DroneSweeps, Sweeps);
+		SlideAlongSurface(Delta, 1.f - Hit.Time, Hit.Normal, Hit, true);
+
+		// 막혔다면 보간할 이전 상태가 없다
+		LastStepOffsetZ = 0.f;
+		LastStepHorizontalOffset = FVector::ZeroVector;
+	}
+
+#if DRONE_STATS
+	if (PendingLatencySampleTime > 0.0)
+	{
+		if (UDroneInputLatencySubsystem* LatencySubsystem = UWorld::GetSubsystem<UDroneInputLatencySubsystem>(GetWorld()))
+		{
+			LatencySubsystem->RecordMotion(this, PendingLatencySampleTime);
+		}
+		PendingLatencySampleTime = 0.0;
+	}
+#endif
+}
+
+int32 UDroneMovementComponent::AdvanceSimClock(float DeltaTime, float& OutStepDeltaTime)
+{
+	const float FixedStep = 1.f / FixedTimestepRate;
+
+	if (!bUseFixedTimestep)
+	{
+		// 중요도 LOD 로 밀린 시간은 한 번에 적분하면 속도 클램프를 넘어서므로 고정 스텝 길이 이하로 나눈다
+		// (고정 스텝 모드처럼 밀린 시간 전체를 따라잡고, 평소 프레임은 한 스텝)
+		VariableSubsteps = SimCatchUpTime > 0.f ? FMath::Max(1, FMath::CeilToInt32(DeltaTime / FixedStep - UE_KINDA_SMALL_NUMBER)) : 1;
+		OutStepDeltaTime = DeltaTime / VariableSubsteps;
+		return VariableSubsteps;
+	}
+
+	// 히치가 나도 MaxSubsteps 만큼만 따라잡고 나머지 시간은 버린다 (중요도 LOD 로 밀린 시간은 예외)
+	const float MaxAccumulatedTime = FMath::Max(FixedStep * MaxSubsteps, SimCatchUpTime + FixedStep);
+	FixedStepAccumulator = FMath::Min(FixedStepAccumulator + DeltaTime, MaxAccumulatedTime);
+	const int32 NumSteps = FMath::FloorToInt32(FixedStepAccumulator / FixedStep);
+	FixedStepAccumulator -= NumSteps * FixedStep;
+	InterpolationAlpha = FixedStepAccumulator / FixedStep;
+
+	OutStepDeltaTime = FixedStep;
+	return NumSteps;
+}
+
+float UDroneMovementComponent::GetStepThrust(float StepDeltaTime) const
+{
+	// 고정 스텝: 입력 축 x 스텝 시간, 배치 가변 스텝: 프레임 동안 누적된 추력을 스텝 수로 나눈 값 (개별 가변 스텝은 AddThrust 에서 즉시 반영)
+	return bUseFixedTimestep ? ThrustAxis * StepDeltaTime : PendingThrust / VariableSubsteps;
+}
+
+float UDroneMovementComponent::SimulateSteps(int32 NumSteps, float StepDeltaTime)
+{
+	if (NumSteps <= 0)
+	{
+		return 0.f;
+	}
 
-	UpdateMovementState(bOnLanded);
+	FDroneKinematicsState State;
+	State.ZVelocity = CurrentZVelocity;
+	State.bFlying = ShouldApplyPhysics();
+
+	const float TotalOffsetZ = DroneKinematics::Simulate(State, NumSteps, GetStepThrust(StepDeltaTime), StepDeltaTime, GetKinematicsParams(), LastStepOffsetZ);
+	CurrentZVelocity = State.ZVelocity;
+	return TotalOffsetZ;
+}
+
+void UDroneMovementComponent::FinishSimFrame(float SimulatedTime)
+{
+	// 고정 스텝 모드의 수평 이동은 이번 프레임에 진행된 시뮬레이션 시간만큼 적용하고, 마지막 스텝 분량은 보간용으로 남긴다
+	const bool bFixedStepAdvanced = bUseFixedTimestep && SimulatedTime > 0.f;
+	FVector FrameHorizontalOffset = FVector::ZeroVector;
+	if (bFixedStepAdvanced && !PendingMoveInput.IsNearlyZero())
+	{
+		FrameHorizontalOffset = QueueMovementOffset(PendingMoveInput, SimulatedTime);
+	}
+
+	// 스텝이 하나도 돌지 않은 프레임의 이동/추력 입력은 버리지 않고 다음 스텝까지 들고 간다
+	if (!bUseFixedTimestep || SimulatedTime > 0.f || IsAsyncPhysics())
+	{
+		PendingMoveInput = FVector2D::ZeroVector;
+		ThrustAxis = 0.f;
+	}
+	PendingThrust = 0.f;
+
+	// 다른 드론과의 접촉은 스윕 대신 회피 조향으로 해소
+	if (SimulatedTime > 0.f && !AvoidanceVelocity.IsZero() && ShouldApplyAvoidance())
+	{
+		const FVector AvoidanceOffset = AvoidanceVelocity * SimulatedTime;
+		PendingTranslation += AvoidanceOffset;
+		FrameHorizontalOffset += AvoidanceOffset;
+	}
+
+	if (bFixedStepAdvanced)
+	{
+		LastStepHorizontalOffset = FrameHorizontalOffset * (1.f / (FixedTimestepRate * SimulatedTime));
+	}
+
+	CommitPendingMove();
+	UpdateReplicatedState();
+	ApplyVisualInterpolation();
+	UpdateSleepState();
+
+	if (bRecordingFrame)
+	{
+		bRecordingFrame = false;
+		FlightRecorder->RecordPostFrame(this);
+	}
+}
+
+bool UDroneMovementComponent::ReceivesAvoidanceSteering() const
+{
+	// 서버가 원격 플레이어의 무브를 재생할 때 섞으면 클라이언트 예측과 어긋난다
+	return PawnOwner && (!PawnOwner->IsPlayerControlled() || PawnOwner->IsLocallyControlled());
+}
+
+bool UDroneMovementComponent::ShouldApplyAvoidance() const
+{
+	return IsFlight() && ReceivesAvoidanceSteering();
 }
 
+bool UDroneMovementComponent::CanSleep() const
+{
+	if (!bAllowSleep || !IsGrounded() || bIsElevating || LastInputCommand.HasFrameInput())
+	{
+		return false;
+	}
+
+	// 남은 속도/추력/이동량이 없어야 한다
+	if (CurrentZVelocity != 0.f || LastStepOffsetZ != 0.f || ThrustAxis != 0.f || PendingThrust != 0.f || (IsAsyncPhysics() && bVelocityOverridePending))
+	{
+		return false;
+	}
+	if (bHasPendingRotation || !PendingTranslation.IsNearlyZero() || !PendingMoveInput.IsNearlyZero() || !LastStepHorizontalOffset.IsNearlyZero())
+	{
+		return false;
+	}
+
+	// 비동기 물리 모드에서는 물리 스레드도 착지 상태로 수렴해 있어야 한다
+	return !IsAsyncPhysics() || (AsyncPhysicsMode == EDroneMovementMode::Grounded && AsyncPhysicsOffsetZ == 0.f);
+}
+
+void UDroneMovementComponent::UpdateSleepState()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (!CanSleep())
+	{
+		IdleStartTime = Now;
+		return;
+	}
+
+	if (Now - IdleStartTime >= SleepDelay)
+	{
+		GoToSleep();
+	}
+}
+
+void UDroneMovementComponent::GoToSleep()
+{
+	if (bIsSleeping)
+	{
+		return;
+	}
+	bIsSleeping = true;
+
+	// 동작으로 이어지지 않은 입력은 지연 샘플로 남기지 않는다
+	PendingLatencySampleTime = 0.0;
+
+	DiscardAsyncGroundTrace();
+
+	// 서브시스템 경로는 잠든 드론을 건너뛰고, 개별 Tick 경로는 Tick 자체를 끈다
+	if (!IsBatched() && !IsAsyncPhysics())
+	{
+		SetComponentTickEnabled(false);
+	}
+
+	// 외부에서 드론을 옮기거나, 받치고 있던 지면이 움직이거나 사라지면 깨어난다
+	if (UpdatedComponent)
+	{
+		SelfTransformHandle = UpdatedComponent->TransformUpdated.AddUObject(this, &ThisClass::HandleSleepTransformUpdated);
+	}
+	if (UPrimitiveComponent* Support = SupportingComponent.Get())
+	{
+		SleepWatchedSupport = Support;
+		SupportTransformHandle = Support->TransformUpdated.AddUObject(this, &ThisClass::HandleSleepTransformUpdated);
+		if (AActor* SupportOwner = Support->GetOwner())
+		{
+			SupportOwner->OnDestroyed.AddDynamic(this, &ThisClass::HandleSupportActorDestroyed);
+		}
+	}
+}
+
+void UDroneMovementComponent::SetSignificanceSettings(float UpdateInterval, float GroundTraceInterval)
+{
+	// 갱신이 드물던 드론은 전환 직후 밀린 시간을 한 번에 따라잡는다
+	if (SimUpdateInterval > 0.f && UpdateInterval != SimUpdateInterval)
+	{
+		bSimCatchUpPending = true;
+	}
+
+	SimUpdateInterval = UpdateInterval;
+	SignificanceGroundTraceInterval = GroundTraceInterval;
+
+	// 개별 Tick 경로는 Tick 간격 자체를 바꾸고, 따라잡을 때는 다음 프레임에 바로 Tick
+	if (!IsBatched() && !IsAsyncPhysics())
+	{
+		if (bSimCatchUpPending)
+		{
+			SetComponentTickIntervalAndCooldown(0.f);
+		}
+		SetComponentTickInterval(UpdateInterval);
+	}
+}
+
+bool UDroneMovementComponent::IsSimUpdateDue() const
+{
+	if (bSimCatchUpPending || SimUpdateInterval <= 0.f || LastSimUpdateTime < 0.0)
+	{
+		return true;
+	}
+	return GetWorld()->GetTimeSeconds() - LastSimUpdateTime >= SimUpdateInterval;
+}
+
+float UDroneMovementComponent::ConsumeSimElapsedTime(float DeltaTime)
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	float Elapsed = DeltaTime;
+	SimCatchUpTime = 0.f;
+
+	if (LastSimUpdateTime >= 0.0 && (SimUpdateInterval > 0.f || bSimCatchUpPending))
+	{
+		Elapsed = FMath::Min(static_cast<float>(Now - LastSimUpdateTime), MaxSimCatchUpTime);
+		SimCatchUpTime = Elapsed;
+	}
+
+	LastSimUpdateTime = Now;
+	bSimCatchUpPending = false;
+	return Elapsed;
+}
+
+void UDroneMovementComponent::WakeUp()
+{
+	if (!bIsSleeping)
+	{
+		return;
+	}
+	bIsSleeping = false;
+
+	UnbindSleepWakeEvents();
+
+	// 깨어난 직후 바로 다시 잠들지 않도록 유휴 시간을 새로 재고, 잠든 시간은 적분하지 않는다
+	IdleStartTime = GetWorld()->GetTimeSeconds();
+	LastSimUpdateTime = -1.0;
+	InvalidateGroundTraceSchedule();
+
+	if (!IsBatched() && !IsAsyncPhysics())
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UDroneMovementComponent::UnbindSleepWakeEvents()
+{
+	if (UpdatedComponent && SelfTransformHandle.IsValid())
+	{
+		UpdatedComponent->TransformUpdated.Remove(SelfTransformHandle);
+	}
+	SelfTransformHandle.Reset();
+
+	if (UPrimitiveComponent* Support = SleepWatchedSupport.Get())
+	{
+		Support->TransformUpdated.Remove(SupportTransformHandle);
+		if (AActor* SupportOwner = Support->GetOwner())
+		{
+			SupportOwner->OnDestroyed.RemoveDynamic(this, &ThisClass::HandleSupportActorDestroyed);
+		}
+	}
+	SupportTransformHandle.Reset();
+	SleepWatchedSupport.Reset();
+}
+
+void UDroneMovementComponent::HandleSleepTransformUpdated(USceneComponent* MovedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	WakeUp();
+}
+
+void UDroneMovementComponent::HandleSupportActorDestroyed(AActor* DestroyedActor)
+{
+	SupportingComponent.Reset();
+	WakeUp();
+}
+
+bool UDroneMovementComponent::ShouldSimulateLocally() const
+{
+	switch (GetOwnerRole())
+	{
+	case ROLE_SimulatedProxy:
+		// 복제된 트랜스폼과 이동 상태를 따른다
+		return false;
+	case ROLE_Authority:
+		// 원격 플레이어가 조종하는 드론은 클라이언트가 보낸 무브로만 진행
+		return !PawnOwner || !PawnOwner->IsPlayerControlled() || PawnOwner->IsLocallyControlled();
+	default:
+		return true;
+	}
+}
+
+FDroneNetState UDroneMovementComponent::CaptureNetState(uint32 MoveId) const
+{
+	FDroneNetState State;
+	State.MoveId = MoveId;
+	State.Location = UpdatedComponent->GetComponentLocation();
+	State.Rotation = UpdatedComponent->GetComponentRotation();
+	State.ZVelocity = CurrentZVelocity;
+	State.MovementMode = MovementMode;
+	State.FixedStepAccumulator = FixedStepAccumulator;
+	State.InterpolationAlpha = InterpolationAlpha;
+	return State;
+}
+
+bool UDroneMovementComponent::HasPredictionError(const FDroneNetState& Predicted, const FDroneNetState& Server) const
+{
+	return Predicted.MovementMode != Server.MovementMode
+		|| FVector::DistSquared(Predicted.Location, Server.Location) > FMath::Square(NetLocationErrorTolerance)
+		|| FMath::Abs(Predicted.ZVelocity - Server.ZVelocity) > NetZVelocityErrorTolerance
+		|| !Predicted.Rotation.Equals(Server.Rotation, NetRotationErrorTolerance)
+		|| (bUseFixedTimestep && !FMath::IsNearlyEqual(Predicted.FixedStepAccumulator, Server.FixedStepAccumulator, UE_KINDA_SMALL_NUMBER));
+}
+
+void UDroneMovementComponent::SavePredictedMove(const FDroneNetMove& Move)
+{
+	// 확인이 오지 않는 동안에는 가장 오래된 무브부터 버린다 (다음 보정에서 서버 상태로 맞춰진다)
+	if (SavedMoves.Num() >= MaxSavedMoves)
+	{
+		SavedMoves.RemoveAt(0, SavedMoves.Num() - MaxSavedMoves + 1, EAllowShrinking::No);
+	}
+	SavedMoves.Add({ Move, CaptureNetState(Move.MoveId) });
+
+	// 비신뢰 전송이므로 확인되지 않은 최근 무브 몇 개를 함께 보내 손실된 패킷을 메운다
+	TArray<FDroneNetMove> MovesToSend;
+	MovesToSend.Reserve(NetMoveRedundancy);
+	for (int32 Index = FMath::Max(0, SavedMoves.Num() - NetMoveRedundancy); Index < SavedMoves.Num(); ++Index)
+	{
+		MovesToSend.Add(SavedMoves[Index].Move);
+	}
+	ServerMoves(MovesToSend);
+}
+
+float UDroneMovementComponent::ConsumeNetMoveTimeBudget(float MoveDeltaTime)
+{
+	// 서버 경과 시간만큼 예산을 채운다 (처음 받은 무브는 최대 예산에서 시작)
+	const double Now = GetWorld()->GetTimeSeconds();
+	NetMoveTimeBudget = LastNetMoveBudgetTime < 0.0
+		? MaxNetMoveTimeBudget
+		: FMath::Min(NetMoveTimeBudget + static_cast<float>(Now - LastNetMoveBudgetTime), MaxNetMoveTimeBudget);
+	LastNetMoveBudgetTime = Now;
+
+	// 서버 시간보다 빨리 흐르는 무브는 남은 예산만큼만 적용한다 (잘린 만큼은 클라이언트가 보정받는다)
+	const float AllowedDeltaTime = FMath::Min(FMath::Clamp(MoveDeltaTime, 0.f, MaxNetMoveDeltaTime), NetMoveTimeBudget);
+	NetMoveTimeBudget -= AllowedDeltaTime;
+	return AllowedDeltaTime;
+}
+
+void UDroneMovementComponent::ServerMoves_Implementation(const TArray<FDroneNetMove>& Moves)
+{
+	if (!CanSimulate())
+	{
+		return;
+	}
+
+	// 클라이언트는 최근 NetMoveRedundancy 개만 보내므로 그보다 앞선 무브는 처리하지 않는다
+	const int32 FirstMoveIndex = FMath::Max(0, Moves.Num() - NetMoveRedundancy);
+
+	bool bProcessedMove = false;
+	for (int32 MoveIndex = FirstMoveIndex; MoveIndex < Moves.Num(); ++MoveIndex)
+	{
+		const FDroneNetMove& Move = Moves[MoveIndex];
+
+		// 중복 전송분이나 순서가 뒤바뀐 무브는 무시
+		if (Move.MoveId <= LastServerMoveId)
+		{
+			continue;
+		}
+
+		WakeUp();
+		InputCommand = Move.ToCommand();
+		SimulateFrame(ConsumeNetMoveTimeBudget(Move.DeltaTime));
+
+		LastServerMoveId = Move.MoveId;
+		bProcessedMove = true;
+	}
+
+	if (bProcessedMove)
+	{
+		ClientAckMove(CaptureNetState(LastServerMoveId));
+	}
+}
+
+void UDroneMovementComponent::ClientAckMove_Implementation(const FDroneNetState& ServerState)
+{
+	// 이미 지난 확인 (순서가 뒤바뀐 패킷) 이면 무시
+	const int32 AckIndex = SavedMoves.IndexOfByPredicate([&ServerState](const FDroneSavedMove& Saved)
+	{
+		return Saved.Move.MoveId == ServerState.MoveId;
+	});
+	if (AckIndex == INDEX_NONE || !CanSimulate())
+	{
+		return;
+	}
+
+	const bool bNeedsCorrection = HasPredictionError(SavedMoves[AckIndex].PredictedState, ServerState);
+	if (bNeedsCorrection && CVarDroneNetLogCorrections.GetValueOnGameThread())
+	{
+		const FDroneNetState& Predicted = SavedMoves[AckIndex].PredictedState;
+		UE_LOG(LogTemp, Log, TEXT("DroneMovementComponent: correction at move %u, predicted %s vz %.1f mode %d, server %s vz %.1f mode %d, replaying %d moves"),
+			ServerState.MoveId,
+			*Predicted.Location.ToCompactString(), Predicted.ZVelocity, static_cast<int32>(Predicted.MovementMode),
+			*ServerState.Location.ToCompactString(), ServerState.ZVelocity, static_cast<int32>(ServerState.MovementMode),
+			SavedMoves.Num() - AckIndex - 1);
+	}
+
+	SavedMoves.RemoveAt(0, AckIndex + 1, EAllowShrinking::No);
+
+	if (bNeedsCorrection)
+	{
+		ApplyServerCorrection(ServerState);
+	}
+}
+
+void UDroneMovementComponent::ApplyServerCorrection(const FDroneNetState& ServerState)
+{
+	DRONE_INC_COUNTER(STAT_DroneNetCorrections, NetCorrections);
+
+	const EDroneMovementMode PredictedMode = MovementMode;
+	const FDroneInputCommand LiveCommand = InputCommand;
+	bSuppressModeEvents = true;
+
+	// 1. 서버가 확인한 상태로 되돌린다 (스윕 없이)
+	PendingTranslation = FVector::ZeroVector;
+	bHasPendingRotation = false;
+	UpdatedComponent->SetWorldLocationAndRotation(ServerState.Location, ServerState.Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+	SetMovementMode(ServerState.MovementMode);
+	CurrentZVelocity = ServerState.ZVelocity;
+	FixedStepAccumulator = ServerState.FixedStepAccumulator;
+	InterpolationAlpha = ServerState.InterpolationAlpha;
+	DiscardAsyncGroundTrace();
+
+	// 2. 확인되지 않은 무브를 다시 시뮬레이션하고 예측 결과를 갱신
+	//    월드 시간이 흐르지 않으므로 예측 지면 감지 스케줄은 무브마다 다시 연다
+	for (FDroneSavedMove& Saved : SavedMoves)
+	{
+		InputCommand = Saved.Move.ToCommand();
+		InvalidateGroundTraceSchedule();
+		SimulateFrame(Saved.Move.DeltaTime);
+		Saved.PredictedState = CaptureNetState(Saved.Move.MoveId);
+	}
+
+	InputCommand = LiveCommand;
+	bSuppressModeEvents = false;
+
+	// 3. 보정 전후로 이동 상태가 달라졌을 때만 한 번 알린다
+	if (MovementMode != PredictedMode)
+	{
+		BroadcastMovementModeChanged();
+	}
+
+	if (FlightRecorder && FlightRecorder->IsRecording())
+	{
+		FlightRecorder->RecordReset(this);
+	}
+}
+
+void UDroneMovementComponent::UpdateReplicatedState()
+{
+	if (GetOwnerRole() != ROLE_Authority || GetNetMode() == NM_Standalone)
+	{
+		return;
+	}
+
+	// 기록만 하고, 바뀌었는지는 연결별 기준과 양자화 값을 비교해 직렬화 시 판단한다
+	ReplicatedState.Location = UpdatedComponent->GetComponentLocation();
+	ReplicatedState.Rotation = UpdatedComponent->GetComponentRotation();
+	ReplicatedState.ZVelocity = CurrentZVelocity;
+	ReplicatedState.MovementMode = MovementMode;
+}
+
+void UDroneMovementComponent::OnRep_ReplicatedState()
+{
+	if (!UpdatedComponent)
+	{
+		return;
+	}
+
+	CurrentZVelocity = ReplicatedState.ZVelocity;
+	SetMovementMode(ReplicatedState.MovementMode);
+
+	// 프록시는 트랜스폼을 복제로 받으므로 델리게이트가 쌓은 이동/회전은 버린다
+	PendingTranslation = FVector::ZeroVector;
+	bHasPendingRotation = false;
+	UpdatedComponent->SetWorldLocationAndRotation(ReplicatedState.Location, ReplicatedState.Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+}
+
+void UDroneMovementComponent::ResetNetPrediction()
+{
+	// 클라이언트 무브 번호는 계속 증가하므로 서버 쪽 기록만 처음부터 다시 받는다
+	SavedMoves.Reset();
+	LastServerMoveId = 0;
+	NetMoveTimeBudget = 0.f;
+	LastNetMoveBudgetTime = -1.0;
+}
+
+void UDroneMovementComponent::SetPooled(bool bInPooled)
+{
+	if (bIsPooled == bInPooled)
+	{
+		return;
+	}
+
+	// 슬립 바인딩부터 푼다 (반납 중 트랜스폼 변화로 깨어나지 않게)
+	WakeUp();
+	bIsPooled = bInPooled;
+
+	if (bIsPooled && FlightRecorder && FlightRecorder->IsRecording())
+	{
+		FlightRecorder->RecordDespawn(this);
+	}
+
+	// 이동/입력/지면 감지/LOD/예측 상태를 스폰 직후 값으로 (델리게이트는 보내지 않는다)
+	bSuppressModeEvents = true;
+	SetMovementMode(EDroneMovementMode::Grounded);
+	bSuppressModeEvents = false;
+
+	CurrentZVelocity = 0.f;
+	bIsElevating = false;
+	InputCommand = FDroneInputCommand();
+	LastInputCommand = FDroneInputCommand();
+	PendingLatencySampleTime = 0.0;
+
+	PendingTranslation = FVector::ZeroVector;
+	bHasPendingRotation = false;
+	PendingThrust = 0.f;
+	FixedStepAccumulator = 0.f;
+	InterpolationAlpha = 0.f;
+	LastStepOffsetZ = 0.f;
+	LastStepHorizontalOffset = FVector::ZeroVector;
+	ThrustAxis = 0.f;
+	PendingMoveInput = FVector2D::ZeroVector;
+	for (int32 Index = 0; Index < InterpolatedComponents.Num(); ++Index)
+	{
+		if (USceneComponent* Component = InterpolatedComponents[Index].Get())
+		{
+			Component->SetRelativeLocation(InterpolatedBaseLocations[Index]);
+		}
+	}
+
+	AsyncPhysicsOffsetZ = 0.f;
+	AsyncPhysicsMode = EDroneMovementMode::Grounded;
+	bVelocityOverridePending = false;
+
+	DiscardAsyncGroundTrace();
+	InvalidateGroundTraceSchedule();
+	CachedGroundDistance = 0.f;
+	bGroundProbeHit = false;
+	LastGroundTraceTime = -1.0;
+	SupportingComponent.Reset();
+
+	LastSimUpdateTime = -1.0;
+	SimCatchUpTime = 0.f;
+	bSimCatchUpPending = false;
+	IdleStartTime = GetWorld()->GetTimeSeconds();
+
+	ResetNetPrediction();
+
+	// 반납 중인 드론은 중요도 예산, 지연 보상 기록, 회피 이웃에서 뺀다 (배열 추가/제거만 하므로 싸다)
+	UDroneSignificanceSubsystem* SignificanceSubsystem = UWorld::GetSubsystem<UDroneSignificanceSubsystem>(GetWorld());
+	UDroneRewindSubsystem* RewindSubsystem = UWorld::GetSubsystem<UDroneRewindSubsystem>(GetWorld());
+	UDroneAvoidanceSubsystem* AvoidanceSubsystem = UWorld::GetSubsystem<UDroneAvoidanceSubsystem>(GetWorld());
+	const bool bRecordRewind = IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer);
+	if (bIsPooled)
+	{
+		if (SignificanceSubsystem)
+		{
+			SignificanceSubsystem->UnregisterDrone(this);
+		}
+		if (RewindSubsystem)
+		{
+			RewindSubsystem->UnregisterDrone(this);
+		}
+		if (AvoidanceSubsystem)
+		{
+			AvoidanceSubsystem->UnregisterDrone(this);
+		}
+	}
+	else
+	{
+		if (SignificanceSubsystem)
+		{
+			SignificanceSubsystem->RegisterDrone(this);
+		}
+		if (RewindSubsystem && bRecordRewind)
+		{
+			RewindSubsystem->RegisterDrone(this);
+		}
+		if (AvoidanceSubsystem && !IsNetMode(NM_Client))
+		{
+			AvoidanceSubsystem->RegisterDrone(this);
+		}
+	}
+
+	SetComponentTickEnabled(!bIsPooled && !IsBatched() && !IsAsyncPhysics());
+}
+
+void UDroneMovementComponent::BuildAsyncPhysicsInput(FDroneAsyncPhysicsDroneInput& OutInput)
+{
+	OutInput.DroneId = AsyncPhysicsId;
+	OutInput.Location = UpdatedComponent->GetComponentLocation();
+	OutInput.GroundZ = LastGroundProbeLocation.Z - CachedGroundDistance;
+	OutInput.bHasGround = bGroundProbeHit;
+	OutInput.bElevating = bIsElevating;
+	OutInput.ThrustAxis = ThrustAxis;
+	OutInput.bOverrideVelocity = bVelocityOverridePending;
+	OutInput.OverrideVelocity = CurrentZVelocity;
+	OutInput.InitialMovementMode = MovementMode;
+	OutInput.GroundDetectionLength = GroundDetectionOffset + SphereRadius;
+	OutInput.GravityZ = GravityZ;
+	OutInput.MaxFallingSpeed = MaxFallingSpeed;
+	OutInput.MaxAscendingSpeed = MaxAscendingSpeed;
+	OutInput.ThrustAccelZ = ThrustAccelZ;
+
+	bVelocityOverridePending = false;
+}
+
+void UDroneMovementComponent::ApplyAsyncPhysicsResults()
+{
+	if (AsyncPhysicsOffsetZ != 0.f)
+	{
+		QueueVerticalOffset(AsyncPhysicsOffsetZ);
+		AsyncPhysicsOffsetZ = 0.f;
+	}
+
+	// 물리 스레드에서 바뀐 이동 상태를 게임 스레드 델리게이트로 전달
+	SetMovementMode(AsyncPhysicsMode);
+}
+
+void UDroneMovementComponent::AddInterpolatedComponent(USceneComponent* Component)
+{
+	if (Component)
+	{
+		InterpolatedComponents.Add(Component);
+		InterpolatedBaseLocations.Add(Component->GetRelativeLocation());
+	}
+}
+
+void UDroneMovementComponent::ApplyVisualInterpolation()
+{
+	if (!bUseFixedTimestep || !UpdatedComponent)
+	{
+		return;
+	}
+
+	// 루트는 최신 시뮬레이션 상태에 두고, 보이는 컴포넌트만 이전 스텝과의 사이로 되돌린다 (수평 + 수직 이동 전체)
+	const FVector LastStepOffset = LastStepHorizontalOffset + FVector(0.f, 0.f, LastStepOffsetZ);
+	const FVector WorldOffset = -(1.f - InterpolationAlpha) * LastStepOffset;
+	const FVector LocalOffset = UpdatedComponent->GetComponentTransform().InverseTransformVectorNoScale(WorldOffset);
+
+	for (int32 Index = 0; Index < InterpolatedComponents.Num(); ++Index)
+	{
+		if (USceneComponent* Component = InterpolatedComponents[Index].Get())
+		{
+			Component->SetRelativeLocation(InterpolatedBaseLocations[Index] + LocalOffset);
+		}
+	}
+}
+
+void UDroneMovementComponent::SetGroundDetectionSettings(float Offset, float InSphereRadius)
+{
+	GroundDetectionOffset = Offset;
+	SphereRadius = InSphereRadius;
+}
+
+void UDroneMovementComponent::PerformGroundTrace()
+{
+	if (!PawnOwner) return;
+
+	// 중요도가 낮은 드론은 프로브 간격을 늘리고 그 사이에는 마지막 판정을 유지
+	// 비동기 요청은 한 프레임만 유효하므로 건너뛰는 동안 버리고, 다음 프로브가 새로 요청한다
+	if (SignificanceGroundTraceInterval > 0.f && LastGroundTraceTime >= 0.0
+		&& GetWorld()->GetTimeSeconds() - LastGroundTraceTime < SignificanceGroundTraceInterval)
+	{
+		DiscardAsyncGroundTrace();
+		return;
+	}
+
+	DRONE_SCOPE_CYCLE_COUNTER(STAT_DroneGroundTrace, GroundTrace);
+
+	const float TraceLen = GroundDetectionOffset + SphereRadius;
+	const FVector Start = PawnOwner->GetActorLocation();
+
+	// 착지할 수 없는 구간이면 트레이스 생략
+	if (CanSkipGroundTrace(Start))
+	{
+		DRONE_INC_COUNTER(STAT_DroneSkippedTraces, SkippedTraces);
+		DiscardAsyncGroundTrace();
+		if (!IsAsyncPhysics())
+		{
+			UpdateMovementState(false);
+		}
+		return;
+	}
+
+	// 정적 지형 위라면 물리 씬 대신 베이크된 높이 캐시 사용
+	float BakedGroundDistance = 0.f;
+	if (SampleBakedGroundDistance(Start, BakedGroundDistance))
+	{
+		DRONE_INC_COUNTER(STAT_DroneHeightFieldSamples, HeightFieldSamples);
+		DiscardAsyncGroundTrace();
+		if (CVarDroneValidateHeightField.GetValueOnGameThread())
+		{
+			ValidateBakedGroundDistance(Start, BakedGroundDistance);
+		}
+		HandleGroundProbeResult(Start, true, BakedGroundDistance, BakedGroundDistance);
+		return;
+	}
+
+	// 예측 모드에서는 지면 거리 캐시를 위해 더 길게 프로브
+	const float ProbeLen = bUsePredictiveGroundTrace ? FMath::Max(GroundProbeDistance, TraceLen) : TraceLen;
+	const FVector End = Start - FVector(0, 0, ProbeLen);
+
+	if (GroundTraceMode == EDroneGroundTraceMode::Async)
+	{
+		PerformAsyncGroundTrace(Start, End);
+		return;
+	}
+
+	FHitResult Hit;
+	const bool bHit = PawnOwner->GetWorld()->LineTraceSingleByChannel(Hit, Start, End, ECC_Visibility);
+	DRONE_FLEET_PERF_INC(GroundTraces);
+	DRONE_INC_COUNTER(STAT_DroneGroundTraces, GroundTraces);
+
+	HandleGroundProbeResult(Start, bHit, Hit.Distance, ProbeLen, Hit.GetComponent());
+}
+
+void UDroneMovementComponent::PerformAsyncGroundTrace(const FVector& Start, const FVector& End)
+{
+	UWorld* World = GetWorld();
+
+	// 이전 프레임에 요청한 결과 소비 (만료되어 조회에 실패하면 이번 프레임은 마지막 판정을 유지하고, 예전 결과를 다시 쓰지 않는다)
+	if (bReplayGroundTraces)
+	{
+		bHasAsyncGroundResult = bReplayGroundTracePending;
+		if (bHasAsyncGroundResult)
+		{
+			bAsyncGroundHit = ReplayGroundTraceHit.bBlockingHit;
+			AsyncGroundHitDistance = bAsyncGroundHit ? ReplayGroundTraceHit.Distance : 0.f;
+			AsyncGroundHitComponent = bAsyncGroundHit ? ReplayGroundTraceHit.GetComponent() : nullptr;
+		}
+	}
+	else
+	{
+		FTraceDatum TraceData;
+		bHasAsyncGroundResult = PendingGroundTrace.IsValid() && World->QueryTraceData(PendingGroundTrace, TraceData);
+		if (bHasAsyncGroundResult)
+		{
+			bAsyncGroundHit = TraceData.OutHits.Num() > 0 && TraceData.OutHits[0].bBlockingHit;
+			AsyncGroundHitDistance = bAsyncGroundHit ? TraceData.OutHits[0].Distance : 0.f;
+			AsyncGroundHitComponent = bAsyncGroundHit ? TraceData.OutHits[0].GetComponent() : nullptr;
+		}
+	}
+
+	const FVector ResultLocation = PendingGroundProbeLocation;
+	const float ResultLength = PendingGroundProbeLength;
+
+	// 다음 프레임용 요청 (같은 프레임의 요청들은 엔진이 한 번에 병렬 처리)
+	DRONE_FLEET_PERF_INC(GroundTraces);
+	DRONE_INC_COUNTER(STAT_DroneGroundTraces, GroundTraces);
+	if (bReplayGroundTraces)
+	{
+		RequestReplayGroundTrace(Start, End);
+	}
+	else
+	{
+		PendingGroundTrace = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, ECC_Visibility);
+		PendingGroundProbeLocation = Start;
+		PendingGroundProbeLength = (Start - End).Size();
+	}
+
+	if (bHasAsyncGroundResult)
+	{
+		HandleGroundProbeResult(ResultLocation, bAsyncGroundHit, AsyncGroundHitDistance, ResultLength, AsyncGroundHitComponent.Get());
+	}
+}
+
+void UDroneMovementComponent::HandleGroundProbeResult(const FVector& ProbeLocation, bool bHit, float HitDistance, float ProbeLength, UPrimitiveComponent* HitComponent)
+{
+	const float TraceLen = GroundDetectionOffset + SphereRadius;
+	const bool bOnLanded = bHit && HitDistance <= TraceLen;
+
+	// 히트가 없으면 지면은 최소한 프로브 길이만큼 떨어져 있다
+	CachedGroundDistance = bHit ? HitDistance : ProbeLength;
+	LastGroundProbeLocation = ProbeLocation;
+	bGroundProbeHit = bHit;
+	LastGroundTraceTime = GetWorld()->GetTimeSeconds();
+
+	// 베이크된 정적 지형은 움직이지 않으므로 지지 컴포넌트가 없다
+	SupportingComponent = bOnLanded ? HitComponent : nullptr;
+
+	// 비동기 물리 모드에서는 지면 거리만 캐시하고 접촉 판정은 물리 스레드에서 한다
+	if (!IsAsyncPhysics())
+	{
+		UpdateMovementState(bOnLanded);
+	}
+	ScheduleNextGroundTrace();
+}
+
+void UDroneMovementComponent::DiscardAsyncGroundTrace()
+{
+	// 소비하지 않은 결과는 오래된 것으로 보고 지운다 (다음 요청 결과가 올 때까지 판정에 쓰지 않는다)
+	bHasAsyncGroundResult = false;
+	bAsyncGroundHit = false;
+	AsyncGroundHitDistance = 0.f;
+	AsyncGroundHitComponent = nullptr;
+	PendingGroundTrace = FTraceHandle();
+	bReplayGroundTracePending = false;
+}
+
+void UDroneMovementComponent::RequestReplayGroundTrace(const FVector& Start, const FVector& End)
+{
+	// 비동기 요청과 같은 채널/쿼리로 지금 트레이스해 두고, 결과는 비동기와 같이 다음 프레임에 소비한다
+	ReplayGroundTraceHit = FHitResult();
+	GetWorld()->LineTraceSingleByChannel(ReplayGroundTraceHit, Start, End, ECC_Visibility);
+	bReplayGroundTracePending = true;
+	PendingGroundProbeLocation = Start;
+	PendingGroundProbeLength = (Start - End).Size();
+}
+
+bool UDroneMovementComponent::SampleBakedGroundDistance(const FVector& Location, float& OutDistance) const
+{
+	float GroundZ = 0.f;
+	if (!HeightField || !HeightField->SampleHeight(Location.X, Location.Y, GroundZ))
+	{
+		return false;
+	}
+
+	// 캐시된 지면보다 아래(오버행 밑 등)면 트레이스로 대체
+	if (Location.Z < GroundZ)
+	{
+		return false;
+	}
+
+	OutDistance = static_cast<float>(Location.Z - GroundZ);
+	return true;
+}
+
+void UDroneMovementComponent::ValidateBakedGroundDistance(const FVector& Location, float CachedDistance) const
+{
+	const float Tolerance = CVarDroneHeightFieldTolerance.GetValueOnGameThread();
+	const FVector End = Location - FVector(0, 0, CachedDistance + Tolerance);
+
+	FHitResult Hit;
+	const bool bHit = GetWorld()->LineTraceSingleByChannel(Hit, Location, End, ECC_Visibility);
+
+	if (!bHit || FMath::Abs(Hit.Distance - CachedDistance) > Tolerance)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DroneMovementComponent: height field mismatch at %s (cache %.1f, trace %s)"),
+			*Location.ToCompactString(), CachedDistance, bHit ? *FString::SanitizeFloat(Hit.Distance) : TEXT("miss"));
+	}
+}
+
+bool UDroneMovementComponent::CanSkipGroundTrace(const FVector& Location) const
+{
+	// 지상에서는 이륙/지면 소실을 바로 감지해야 하므로 항상 프로브
+	if (!bUsePredictiveGroundTrace || !IsFlight())
+	{
+		return false;
+	}
+
+	if (GetWorld()->GetTimeSeconds() >= NextGroundTraceTime)
+	{
+		return false;
+	}
+
+	if (bConservativeGroundProbe && FVector::DistSquared2D(Location, LastGroundProbeLocation) > FMath::Square(ReprobeLateralDistance))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+void UDroneMovementComponent::ScheduleNextGroundTrace()
+{
+	InvalidateGroundTraceSchedule();
+
+	if (!bUsePredictiveGroundTrace || !IsFlight())
+	{
+		return;
+	}
+
+	// 명시적 오일러 적분은 연속해보다 한 프레임 분량 더 떨어질 수 있으므로 그만큼 여유를 둔다
+	const float TraceLen = GroundDetectionOffset + SphereRadius;
+	const float FrameSlack = (FMath::Abs(MaxFallingSpeed) + FMath::Abs(MaxAscendingSpeed)) * GetWorld()->GetDeltaSeconds();
+	const float FallDistance = CachedGroundDistance - TraceLen - FrameSlack;
+
+	const float TimeToGround = ComputeEarliestTimeToGround(FallDistance);
+	if (TimeToGround > 0.f)
+	{
+		NextGroundTraceTime = GetWorld()->GetTimeSeconds() + FMath::Min(TimeToGround, MaxGroundTraceSkipTime);
+	}
+}
+
+float UDroneMovementComponent::ComputeEarliestTimeToGround(float FallDistance) const
+{
+	if (FallDistance <= 0.f)
+	{
+		return 0.f;
+	}
+
+	// 최악의 경우: 중력 + 최대 하강 추력, 속도는 MaxFallingSpeed 에서 포화
+	const float Accel = GravityZ - ThrustAccelZ;
+	const float V0 = FMath::Max(CurrentZVelocity, MaxFallingSpeed);
+
+	if (MaxFallingSpeed >= 0.f || Accel > -UE_KINDA_SMALL_NUMBER)
+	{
+		return V0 < 0.f ? FallDistance / -V0 : MaxGroundTraceSkipTime;
+	}
+
+	const float TimeToTerminal = (MaxFallingSpeed - V0) / Accel;
+	const float DropToTerminal = -(V0 * TimeToTerminal + 0.5f * Accel * TimeToTerminal * TimeToTerminal);
+
+	if (FallDistance <= DropToTerminal)
+	{
+		// V0*t + 0.5*a*t^2 = -FallDistance 의 양의 근
+		return (-V0 - FMath::Sqrt(V0 * V0 - 2.f * Accel * FallDistance)) / Accel;
+	}
+
+	return TimeToTerminal + (FallDistance - DropToTerminal) / -MaxFallingSpeed;
+}
\ No newline at end of file
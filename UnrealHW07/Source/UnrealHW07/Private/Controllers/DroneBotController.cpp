@@ -0,0 +1,254 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Controllers/DroneBotController.h"
+
+#include "Components/Input/HWInputComponent.h"
+#include "Components/Movement/DroneMovementComponent.h"
+#include "Data/DataAsset_InputConfig.h"
+#include "DroneStats.h"
+#include "EnhancedPlayerInput.h"
+#include "GameFramework/PlayerState.h"
+#include "HWGameplayTags.h"
+#include "InputAction.h"
+#include "Pawns/DronePawn.h"
+
+namespace DroneBot
+{
+	// 착지 전환은 상승/하강 입력을 떼야 일어나므로 이륙 높이 위 이 거리부터는 입력 없이 내려앉는다
+	constexpr float LandingReleaseHeight = 20.f;
+}
+
+ADroneBotController::ADroneBotController()
+{
+	PrimaryActorTick.bCanEverTick = true;
+
+	// 봇은 화면/카메라가 필요 없다
+	bAutoManageActiveCameraTarget = false;
+	OverridePlayerInputClass = UEnhancedPlayerInput::StaticClass();
+}
+
+void ADroneBotController::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 로컬 플레이어가 없으면 엔진이 입력 시스템을 만들지 않을 수 있다
+	if (!PlayerInput)
+	{
+		InitInputSystem();
+	}
+
+	// 사람 플레이어로 집계되지 않게 (서버 권한 시뮬레이션 대상이 되도록)
+	if (PlayerState)
+	{
+		PlayerState->SetIsABot(true);
+	}
+}
+
+void ADroneBotController::OnPossess(APawn* InPawn)
+{
+	Super::OnPossess(InPawn);
+
+	DronePawn = Cast<ADronePawn>(InPawn);
+	BotInputComponent = nullptr;
+	BotInputStack.Reset();
+	MoveAction = LookAction = ElevateAction = RollAction = nullptr;
+
+	if (!DronePawn)
+	{
+		return;
+	}
+
+	HomeLocation = InPawn->GetActorLocation();
+	PatrolTarget = HomeLocation;
+	BehaviorTime = 0.f;
+	GroundedTime = 0.f;
+
+	// 공중에서 스폰된 드론은 이륙 높이를 모르므로 입력 없이 먼저 착지시킨다
+	bLandingSpamDescending = true;
+	bHasLandingSpamTakeoffZ = false;
+
+	// 입력 설정이 아직 로드 중이면 끝난 뒤 바인딩 (그 사이 봇은 입력 없이 대기)
+	DronePawn->CallOrRegister_OnPawnDataLoaded(FSimpleDelegate::CreateUObject(this, &ThisClass::BindBotInput));
+}
+
+void ADroneBotController::BindBotInput()
+{
+	// 로드 중에 빙의가 풀렸거나 이미 바인딩했으면 무시
+	if (!DronePawn || BotInputComponent)
+	{
+		return;
+	}
+
+	const UDataAsset_InputConfig* InputConfig = DronePawn->GetInputConfig();
+	if (!InputConfig)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DroneBotController: %s has no input config, bot stays idle"), *GetNameSafe(DronePawn));
+		return;
+	}
+
+	// 사람 플레이어와 같은 태그 → 액션 → 핸들러 바인딩
+	BotInputComponent = NewObject<UHWInputComponent>(this, TEXT("BotInputComponent"));
+	DronePawn->BindInputActions(BotInputComponent);
+	BotInputStack.Add(BotInputComponent);
+
+	MoveAction = InputConfig->FindNativeInputActionByTag(HWGameplayTags::InputTag_Move);
+	LookAction = InputConfig->FindNativeInputActionByTag(HWGameplayTags::InputTag_Look);
+	ElevateAction = InputConfig->FindNativeInputActionByTag(HWGameplayTags::InputTag_Elevate);
+	RollAction = InputConfig->FindNativeInputActionByTag(HWGameplayTags::InputTag_Roll);
+}
+
+void ADroneBotController::OnUnPossess()
+{
+	Super::OnUnPossess();
+
+	DronePawn = nullptr;
+	BotInputComponent = nullptr;
+	BotInputStack.Reset();
+}
+
+void ADroneBotController::ProcessPlayerInput(const float DeltaTime, const bool bGamePaused)
+{
+}
+
+void ADroneBotController::SetBehavior(EDroneBotBehavior InBehavior, int32 InSeed)
+{
+	Behavior = InBehavior;
+	Random.Initialize(InSeed);
+
+	// 봇마다 위상을 흩어 같은 프레임에 전환이 몰리지 않게 한다
+	BehaviorTime = Random.FRandRange(0.f, ClimbDivePeriod);
+}
+
+int32 ADroneBotController::ConsumeInjectedActionCount()
+{
+	const int32 Count = InjectedActionCount;
+	InjectedActionCount = 0;
+	return Count;
+}
+
+void ADroneBotController::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	UEnhancedPlayerInput* EnhancedInput = Cast<UEnhancedPlayerInput>(PlayerInput);
+	if (!DronePawn || !EnhancedInput || BotInputStack.IsEmpty())
+	{
+		return;
+	}
+
+	DRONE_TRACE_SCOPE(ADroneBotController::Tick);
+
+	const FBotInput Input = UpdateBehavior(DeltaSeconds);
+
+	// 사람이 누르지 않은 축은 주입하지 않는다 (트리거가 Completed 를 내도록)
+	if (!Input.Move.IsNearlyZero())
+	{
+		InjectAction(MoveAction, FVector(Input.Move, 0.f));
+	}
+	if (!Input.Look.IsNearlyZero())
+	{
+		InjectAction(LookAction, FVector(Input.Look, 0.f));
+	}
+	if (!FMath::IsNearlyZero(Input.Elevate))
+	{
+		InjectAction(ElevateAction, FVector(Input.Elevate, 0.f, 0.f));
+	}
+	if (!FMath::IsNearlyZero(Input.Roll))
+	{
+		InjectAction(RollAction, FVector(Input.Roll, 0.f, 0.f));
+	}
+
+	EnhancedInput->ProcessInputStack(BotInputStack, DeltaSeconds, GetWorld()->IsPaused());
+}
+
+void ADroneBotController::InjectAction(UInputAction* Action, const FVector& Value)
+{
+	if (!Action)
+	{
+		return;
+	}
+
+	CastChecked<UEnhancedPlayerInput>(PlayerInput)->InjectInputForAction(Action, FInputActionValue(Action->ValueType, Value));
+	++InjectedActionCount;
+}
+
+ADroneBotController::FBotInput ADroneBotController::UpdateBehavior(float DeltaSeconds)
+{
+	BehaviorTime += DeltaSeconds;
+
+	const UDroneMovementComponent* Movement = DronePawn->GetDroneMovement();
+	const bool bGrounded = Movement && Movement->IsGrounded();
+	const FVector Location = DronePawn->GetActorLocation();
+
+	FBotInput Input;
+	switch (Behavior)
+	{
+	case EDroneBotBehavior::Hover:
+		Input.Elevate = GetHoldAltitudeThrust(HomeLocation.Z + HoverHeight);
+		Input.Look = FVector2D(0.1f, 0.f);
+		break;
+
+	case EDroneBotBehavior::Patrol:
+	{
+		// 도착하면 스폰 지점 주변의 다음 웨이포인트
+		if (FVector::DistSquared2D(Location, PatrolTarget) < FMath::Square(300.f))
+		{
+			const FVector2D Offset = FVector2D(Random.FRandRange(-1.f, 1.f), Random.FRandRange(-1.f, 1.f)).GetSafeNormal() * Random.FRandRange(0.f, PatrolRadius);
+			PatrolTarget = HomeLocation + FVector(Offset, 0.f);
+		}
+
+		const float TargetYaw = (PatrolTarget - Location).Rotation().Yaw;
+		const float YawError = FRotator::NormalizeAxis(TargetYaw - DronePawn->GetActorRotation().Yaw);
+
+		Input.Elevate = GetHoldAltitudeThrust(HomeLocation.Z + HoverHeight);
+		Input.Look = FVector2D(FMath::Clamp(YawError * 0.1f, -2.f, 2.f), 0.f);
+		Input.Move = FVector2D(0.f, FMath::Abs(YawError) < 45.f ? 1.f : 0.2f);
+		Input.Roll = bGrounded ? 0.f : FMath::Clamp(YawError / 45.f, -1.f, 1.f);
+		break;
+	}
+
+	case EDroneBotBehavior::ClimbDive:
+		Input.Elevate = FMath::Fmod(BehaviorTime, ClimbDivePeriod) < ClimbDivePeriod * 0.5f ? 1.f : -1.f;
+		Input.Move = FVector2D(0.f, 1.f);
+		Input.Look = FVector2D(0.5f, 0.f);
+		break;
+
+	case EDroneBotBehavior::LandingSpam:
+		// 착지 → 대기 → 이륙 높이에서 LandingSpamHopHeight 까지 상승 → 지면까지 하강을 반복 (착지/이륙 전환 부하)
+		GroundedTime = bGrounded ? GroundedTime + DeltaSeconds : 0.f;
+		if (bGrounded)
+		{
+			LandingSpamTakeoffZ = Location.Z;
+			bHasLandingSpamTakeoffZ = true;
+			bLandingSpamDescending = false;
+			Input.Elevate = GroundedTime >= LandingSpamGroundTime ? 1.f : 0.f;
+		}
+		else
+		{
+			if (!bLandingSpamDescending && Location.Z - LandingSpamTakeoffZ >= LandingSpamHopHeight)
+			{
+				bLandingSpamDescending = true;
+			}
+
+			if (!bLandingSpamDescending)
+			{
+				Input.Elevate = 1.f;
+			}
+			else if (bHasLandingSpamTakeoffZ && Location.Z - LandingSpamTakeoffZ > DroneBot::LandingReleaseHeight)
+			{
+				Input.Elevate = -1.f;
+			}
+		}
+		break;
+	}
+
+	return Input;
+}
+
+float ADroneBotController::GetHoldAltitudeThrust(float TargetZ) const
+{
+	const UDroneMovementComponent* Movement = DronePawn->GetDroneMovement();
+	const float ZVelocity = Movement ? Movement->GetCurrentZVelocity() : 0.f;
+	const float AltitudeError = TargetZ - static_cast<float>(DronePawn->GetActorLocation().Z);
+	return FMath::Clamp(AltitudeError / 500.f - ZVelocity / 800.f, -1.f, 1.f);
+}
@@ -0,0 +1,135 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Data/DroneHeightField.h"
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+FDroneHeightField::FDroneHeightField() = default;
+
+FDroneHeightField::~FDroneHeightField()
+{
+	// 영역을 먼저 해제한 뒤 핸들을 닫는다
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+bool FDroneHeightField::Load(const FString& Filename)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	FOpenMappedResult OpenResult = PlatformFile.OpenMappedEx(*Filename);
+	if (OpenResult.HasError())
+	{
+		return false;
+	}
+	MappedHandle = OpenResult.StealValue();
+
+	const int64 FileSize = MappedHandle->GetFileSize();
+	if (FileSize < static_cast<int64>(sizeof(FDroneHeightFieldHeader)))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DroneHeightField: %s is too small"), *Filename);
+		MappedHandle.Reset();
+		return false;
+	}
+
+	MappedRegion.Reset(MappedHandle->MapRegion(0, FileSize));
+	if (!MappedRegion)
+	{
+		MappedHandle.Reset();
+		return false;
+	}
+
+	const uint8* Data = MappedRegion->GetMappedPtr();
+	FMemory::Memcpy(&Header, Data, sizeof(FDroneHeightFieldHeader));
+
+	const int64 NumSamples = static_cast<int64>(Header.NumTilesX) * Header.NumTilesY * Header.TileCells * Header.TileCells;
+	const bool bValidHeader = Header.Magic == FDroneHeightFieldHeader::ExpectedMagic
+		&& Header.Version == FDroneHeightFieldHeader::ExpectedVersion
+		&& Header.CellSize > 0.f && Header.TileCells > 1
+		&& FileSize == static_cast<int64>(sizeof(FDroneHeightFieldHeader)) + NumSamples * static_cast<int64>(sizeof(float));
+
+	if (!bValidHeader)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DroneHeightField: %s has an invalid header"), *Filename);
+		MappedRegion.Reset();
+		MappedHandle.Reset();
+		return false;
+	}
+
+	Heights = reinterpret_cast<const float*>(Data + sizeof(FDroneHeightFieldHeader));
+	return true;
+}
+
+float FDroneHeightField::GetSample(int32 SampleX, int32 SampleY) const
+{
+	const int32 TileX = SampleX / Header.TileCells;
+	const int32 TileY = SampleY / Header.TileCells;
+	const int32 LocalX = SampleX - TileX * Header.TileCells;
+	const int32 LocalY = SampleY - TileY * Header.TileCells;
+
+	const int64 TileIndex = static_cast<int64>(TileY) * Header.NumTilesX + TileX;
+	const int64 TileStride = static_cast<int64>(Header.TileCells) * Header.TileCells;
+	return Heights[TileIndex * TileStride + LocalY * Header.TileCells + LocalX];
+}
+
+bool FDroneHeightField::SampleHeight(double X, double Y, float& OutHeight) const
+{
+	if (!Heights)
+	{
+		return false;
+	}
+
+	const double GridX = (X - Header.OriginX) / Header.CellSize;
+	const double GridY = (Y - Header.OriginY) / Header.CellSize;
+	const int32 SampleX = FMath::FloorToInt32(GridX);
+	const int32 SampleY = FMath::FloorToInt32(GridY);
+
+	const int32 NumSamplesX = Header.NumTilesX * Header.TileCells;
+	const int32 NumSamplesY = Header.NumTilesY * Header.TileCells;
+	if (SampleX < 0 || SampleY < 0 || SampleX + 1 >= NumSamplesX || SampleY + 1 >= NumSamplesY)
+	{
+		return false;
+	}
+
+	// 네 샘플이 한 타일 안에 있어야 함 (타일 경계는 트레이스로 대체)
+	const int32 LastLocal = Header.TileCells - 1;
+	if (SampleX % Header.TileCells == LastLocal || SampleY % Header.TileCells == LastLocal)
+	{
+		return false;
+	}
+
+	const float H00 = GetSample(SampleX, SampleY);
+	const float H10 = GetSample(SampleX + 1, SampleY);
+	const float H01 = GetSample(SampleX, SampleY + 1);
+	const float H11 = GetSample(SampleX + 1, SampleY + 1);
+	if (H00 == InvalidHeight || H10 == InvalidHeight || H01 == InvalidHeight || H11 == InvalidHeight)
+	{
+		return false;
+	}
+
+	const float AlphaX = static_cast<float>(GridX - SampleX);
+	const float AlphaY = static_cast<float>(GridY - SampleY);
+	OutHeight = FMath::BiLerp(H00, H10, H01, H11, AlphaX, AlphaY);
+	return true;
+}
+
+FString FDroneHeightField::GetHeightFieldPath(const FString& MapPackageName)
+{
+	return FPaths::ProjectContentDir() / TEXT("HeightFields") / (FPackageName::GetShortName(MapPackageName) + TEXT(".dhf"));
+}
+
+bool FDroneHeightField::Save(const FString& Filename, const FDroneHeightFieldHeader& InHeader, const TArray<float>& TileMajorHeights)
+{
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(sizeof(FDroneHeightFieldHeader) + TileMajorHeights.Num() * sizeof(float));
+
+	FMemory::Memcpy(Bytes.GetData(), &InHeader, sizeof(FDroneHeightFieldHeader));
+	FMemory::Memcpy(Bytes.GetData() + sizeof(FDroneHeightFieldHeader), TileMajorHeights.GetData(), TileMajorHeights.Num() * sizeof(float));
+
+	return FFileHelper::SaveArrayToFile(Bytes, *Filename);
+}
@@ -0,0 +1,26 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "DroneStats.h"
+
+/** Cycle Stats **/
+DEFINE_STAT(STAT_DroneMovementTick);
+DEFINE_STAT(STAT_DroneMovementBatch);
+DEFINE_STAT(STAT_DroneGroundTrace);
+DEFINE_STAT(STAT_DroneCommitMove);
+DEFINE_STAT(STAT_DroneCameraInterp);
+DEFINE_STAT(STAT_DroneInput);
+
+/** Frame Counters **/
+DEFINE_STAT(STAT_DroneGroundTraces);
+DEFINE_STAT(STAT_DroneHeightFieldSamples);
+DEFINE_STAT(STAT_DroneSkippedTraces);
+DEFINE_STAT(STAT_DroneSweeps);
+DEFINE_STAT(STAT_DroneModeTransitions);
+DEFINE_STAT(STAT_DroneNetCorrections);
+
+/** Persistent Counters **/
+DEFINE_STAT(STAT_DroneActiveCameraInterps);
+
+#if DRONE_STATS
+CSV_DEFINE_CATEGORY_MODULE(UNREALHW07_API, Drone, true);
+#endif
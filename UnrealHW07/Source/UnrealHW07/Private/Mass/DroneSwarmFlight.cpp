@@ -0,0 +1,105 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Mass/DroneSwarmFlight.h"
+
+#include "Components/Movement/DroneInputCommand.h"
+#include "Components/Movement/DroneMovementComponent.h"
+#include "Data/DroneHeightField.h"
+#include "Mass/DroneSwarmFragments.h"
+#include "Physics/DroneKinematics.h"
+#include "Subsystems/DroneSwarmSubsystem.h"
+
+void DroneSwarmFlight::Simulate(FDroneSwarmTransformFragment& Transform, FDroneSwarmFlightFragment& Flight, const FDroneSwarmFrameData& FrameData, float DeltaTime)
+{
+	// 1. 스크립트 입력: 상승 중에는 매 프레임 하강 속도 리셋 (승격 폰에는 bVelocityReset 으로 같은 값이 간다)
+	const float Thrust = GetScriptThrust(FrameData.ScriptTime, Flight.ScriptPhase);
+	const bool bElevating = Thrust > 0.f;
+	if (bElevating)
+	{
+		DroneKinematics::ApplyVelocityReset(Flight.ZVelocity, Thrust, FrameData.Params);
+	}
+
+	// 2. 지면 판정: 베이크된 높이맵 (없으면 기준 높이), 트레이스 없음
+	float GroundZ = FrameData.GroundReferenceZ;
+	if (FrameData.HeightField)
+	{
+		FrameData.HeightField->SampleHeight(Transform.Location.X, Transform.Location.Y, GroundZ);
+	}
+	const bool bOnLanded = Transform.Location.Z - GroundZ <= FrameData.GroundProbeLength;
+
+	switch (DroneKinematics::ResolveTransition(Flight.MovementMode != EDroneMovementMode::Grounded, bOnLanded, bElevating))
+	{
+	case EDroneKinematicsTransition::Land:
+		// UDroneMovementComponent::SetMovementMode 와 같이 착지하면 수직 속도를 비운다
+		Flight.MovementMode = EDroneMovementMode::Grounded;
+		Flight.ZVelocity = 0.f;
+		break;
+	case EDroneKinematicsTransition::TakeOff:
+		Flight.MovementMode = EDroneMovementMode::Flying;
+		break;
+	default:
+		break;
+	}
+
+	// 3. 적분: 승격할 드론 클래스와 같은 스텝 방식을 써야 승격/강등 경계에서 궤적이 이어진다
+	int32 NumSteps = 1;
+	float StepDeltaTime = DeltaTime;
+	if (FrameData.bUseFixedTimestep)
+	{
+		// 고정 스텝 (히치가 나도 MaxSubsteps 만큼만 따라잡는다)
+		const float MaxAccumulatedTime = FrameData.FixedStep * FrameData.MaxSubsteps;
+		Flight.FixedStepAccumulator = FMath::Min(Flight.FixedStepAccumulator + DeltaTime, MaxAccumulatedTime);
+		NumSteps = FMath::FloorToInt32(Flight.FixedStepAccumulator / FrameData.FixedStep);
+		Flight.FixedStepAccumulator -= NumSteps * FrameData.FixedStep;
+		StepDeltaTime = FrameData.FixedStep;
+	}
+
+	FDroneKinematicsState State;
+	State.ZVelocity = Flight.ZVelocity;
+	State.bFlying = Flight.MovementMode == EDroneMovementMode::Flying;
+
+	float LastStepOffsetZ = 0.f;
+	Transform.Location.Z += DroneKinematics::Simulate(State, NumSteps, Thrust * StepDeltaTime, StepDeltaTime, FrameData.Params, LastStepOffsetZ);
+	Flight.ZVelocity = State.ZVelocity;
+
+	// 충돌 대신 지면 아래로는 내려가지 않게만 한다
+	if (Transform.Location.Z < GroundZ)
+	{
+		Transform.Location.Z = GroundZ;
+		Flight.ZVelocity = FMath::Max(Flight.ZVelocity, 0.f);
+	}
+
+	// 4. 비행 중에는 기수 방향으로 순항하며 천천히 선회
+	if (State.bFlying)
+	{
+		const float SimulatedTime = NumSteps * StepDeltaTime;
+		const float YawDelta = FrameData.TurnRate * SimulatedTime;
+		if (FrameData.bUseFixedTimestep)
+		{
+			// 고정 스텝 컴포넌트는 선회 입력을 먼저 반영하고 시뮬레이션된 시간만큼 이동한다
+			Transform.Yaw = FRotator::NormalizeAxis(Transform.Yaw + YawDelta);
+			Transform.Location += FRotator(0.f, Transform.Yaw, 0.f).Vector() * (FrameData.CruiseSpeed * SimulatedTime);
+		}
+		else
+		{
+			// 가변 스텝 컴포넌트는 입력을 소비할 때 현재 기수 방향으로 이동한 뒤 선회한다
+			Transform.Location += FRotator(0.f, Transform.Yaw, 0.f).Vector() * (FrameData.CruiseSpeed * SimulatedTime);
+			Transform.Yaw = FRotator::NormalizeAxis(Transform.Yaw + YawDelta);
+		}
+	}
+}
+
+void DroneSwarmFlight::FillInputCommand(FDroneInputCommand& Command, const UDroneMovementComponent& Movement, const FDroneSwarmFrameData& FrameData, float ScriptPhase, float DeltaTime)
+{
+	Command.Thrust = GetScriptThrust(FrameData.ScriptTime, ScriptPhase);
+	Command.bElevating = Command.Thrust > 0.f;
+	Command.bVelocityReset = Command.bElevating;
+
+	if (Movement.IsFlight())
+	{
+		// 이동 축 1 은 비행 이동 속도이므로 순항 속도에 맞춰 나눈다 (축 클램프 없이 그대로 반영된다)
+		const float FlyingMoveSpeed = Movement.GetFlyingMoveSpeed();
+		Command.Move = FVector2D(0.f, FlyingMoveSpeed > 0.f ? FrameData.CruiseSpeed / FlyingMoveSpeed : 0.f);
+		Command.Look.X += FrameData.TurnRate * DeltaTime;
+	}
+}
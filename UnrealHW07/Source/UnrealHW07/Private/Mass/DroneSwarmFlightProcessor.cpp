@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Mass/DroneSwarmFlightProcessor.h"
+
+#include "DroneStats.h"
+#include "MassEntityManager.h"
+#include "MassExecutionContext.h"
+#include "Mass/DroneSwarmFlight.h"
+#include "Mass/DroneSwarmFragments.h"
+#include "Subsystems/DroneSwarmSubsystem.h"
+
+UDroneSwarmFlightProcessor::UDroneSwarmFlightProcessor()
+	: FlightQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = true;
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+
+	// 게임 스레드 객체를 건드리지 않으므로 워커에서 실행 가능
+	bRequiresGameThreadExecution = false;
+}
+
+void UDroneSwarmFlightProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	FlightQuery.AddRequirement<FDroneSwarmTransformFragment>(EMassFragmentAccess::ReadWrite);
+	FlightQuery.AddRequirement<FDroneSwarmFlightFragment>(EMassFragmentAccess::ReadWrite);
+	FlightQuery.AddRequirement<FDroneSwarmInstanceFragment>(EMassFragmentAccess::ReadOnly);
+	FlightQuery.AddTagRequirement<FDroneSwarmTag>(EMassFragmentPresence::All);
+}
+
+void UDroneSwarmFlightProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	DRONE_TRACE_SCOPE(UDroneSwarmFlightProcessor::Execute);
+
+	UWorld* World = EntityManager.GetWorld();
+	UDroneSwarmSubsystem* Swarm = World ? World->GetSubsystem<UDroneSwarmSubsystem>() : nullptr;
+	if (!Swarm || Swarm->InstanceEntities.IsEmpty())
+	{
+		return;
+	}
+
+	const FDroneSwarmFrameData& FrameData = Swarm->FrameData;
+	const float DeltaTime = Context.GetDeltaTimeSeconds();
+
+	TArray<FTransform>& InstanceTransforms = Swarm->InstanceTransforms;
+	TArray<uint8>& PromotionRequests = Swarm->PromotionRequests;
+
+	FlightQuery.ParallelForEachEntityChunk(Context, [&](FMassExecutionContext& ChunkContext)
+	{
+		const TArrayView<FDroneSwarmTransformFragment> Transforms = ChunkContext.GetMutableFragmentView<FDroneSwarmTransformFragment>();
+		const TArrayView<FDroneSwarmFlightFragment> Flights = ChunkContext.GetMutableFragmentView<FDroneSwarmFlightFragment>();
+		const TConstArrayView<FDroneSwarmInstanceFragment> Instances = ChunkContext.GetFragmentView<FDroneSwarmInstanceFragment>();
+
+		for (int32 Index = 0; Index < ChunkContext.GetNumEntities(); ++Index)
+		{
+			FDroneSwarmTransformFragment& Transform = Transforms[Index];
+			FDroneSwarmFlightFragment& Flight = Flights[Index];
+
+			// 1. 비행 (승격 폰이 입력 명령으로 받는 것과 같은 스크립트)
+			DroneSwarmFlight::Simulate(Transform, Flight, FrameData, DeltaTime);
+
+			// 2. 슬롯 출력: 렌더 트랜스폼과 승격 요청
+			const int32 InstanceIndex = Instances[Index].InstanceIndex;
+			if (!InstanceTransforms.IsValidIndex(InstanceIndex))
+			{
+				continue;
+			}
+
+			InstanceTransforms[InstanceIndex] = FTransform(FRotator(0.f, Transform.Yaw, 0.f), Transform.Location);
+
+			bool bNearView = false;
+			for (const FVector& ViewLocation : FrameData.ViewLocations)
+			{
+				bNearView |= FVector::DistSquared(Transform.Location, ViewLocation) <= FrameData.PromoteDistanceSq;
+			}
+			PromotionRequests[InstanceIndex] = bNearView ? 1 : 0;
+		}
+	});
+}
@@ -0,0 +1,91 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Net/DroneRelevancyGrid.h"
+
+void FDroneRelevancyGrid::Reset()
+{
+	// 비게 된 셀은 지우고, 남은 셀은 항목 배열 메모리를 유지
+	for (int32 Index = Cells.Num() - 1; Index >= 0; --Index)
+	{
+		if (Cells[Index].Items.IsEmpty())
+		{
+			Cells.RemoveAtSwap(Index, EAllowShrinking::No);
+		}
+		else
+		{
+			Cells[Index].Items.Reset();
+		}
+	}
+
+	CellIndices.Reset();
+	for (int32 Index = 0; Index < Cells.Num(); ++Index)
+	{
+		CellIndices.Add(Cells[Index].Coord, Index);
+	}
+}
+
+int32 FDroneRelevancyGrid::Add(int32 Item, const FVector& Location)
+{
+	const FIntVector Coord = GetCellCoord(Location);
+
+	int32 CellIndex;
+	if (const int32* Found = CellIndices.Find(Coord))
+	{
+		CellIndex = *Found;
+	}
+	else
+	{
+		CellIndex = Cells.AddDefaulted();
+		FCell& Cell = Cells[CellIndex];
+		Cell.Coord = Coord;
+
+		const FVector Min(Coord.X * Settings.CellSize, Coord.Y * Settings.CellSize, Coord.Z * Settings.CellHeight);
+		Cell.Bounds = FBox(Min, Min + FVector(Settings.CellSize, Settings.CellSize, Settings.CellHeight));
+		CellIndices.Add(Coord, CellIndex);
+	}
+
+	Cells[CellIndex].Items.Add(Item);
+	return CellIndex;
+}
+
+bool FDroneRelevancyGrid::IsCellInRange(const FCell& Cell, const FVector& ViewLocation) const
+{
+	if (Cell.Items.IsEmpty())
+	{
+		return false;
+	}
+
+	const FVector HighestPoint(ViewLocation.X, ViewLocation.Y, Cell.Bounds.Max.Z);
+	const float MaxCull = GetCullDistance(HighestPoint, false, ViewLocation);
+	return Cell.Bounds.ComputeSquaredDistanceToPoint(ViewLocation) <= FMath::Square(MaxCull);
+}
+
+float FDroneRelevancyGrid::GetCullDistance(const FVector& DroneLocation, bool bGrounded, const FVector& ViewLocation) const
+{
+	const float BaseDistance = bGrounded ? Settings.GroundedCullDistance : Settings.FlyingCullDistance;
+	const float Altitude = FMath::Max(0.f, static_cast<float>(FMath::Max(DroneLocation.Z, ViewLocation.Z)) - Settings.GroundReferenceZ);
+	return FMath::Min(BaseDistance + Altitude * Settings.AltitudeCullScale, Settings.MaxCullDistance);
+}
+
+int32 FDroneRelevancyGrid::GetReplicationPeriod(float Distance, bool bGrounded) const
+{
+	int32 Period = Settings.FarPeriod;
+	if (Distance <= Settings.NearDistance)
+	{
+		Period = Settings.NearPeriod;
+	}
+	else if (Distance <= Settings.FarDistance)
+	{
+		Period = Settings.MidPeriod;
+	}
+
+	return bGrounded ? Period * Settings.GroundedPeriodScale : Period;
+}
+
+FIntVector FDroneRelevancyGrid::GetCellCoord(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / Settings.CellSize),
+		FMath::FloorToInt32(Location.Y / Settings.CellSize),
+		FMath::FloorToInt32(Location.Z / Settings.CellHeight));
+}
@@ -0,0 +1,234 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Net/DroneReplicationGraph.h"
+
+#include "Components/Movement/DroneMovementComponent.h"
+#include "DroneStats.h"
+#include "Engine/NetConnection.h"
+#include "GameFramework/PlayerController.h"
+#include "Pawns/DronePawn.h"
+
+UDroneReplicationGraphNode_Grid3D::UDroneReplicationGraphNode_Grid3D()
+{
+	bRequiresPrepareForReplicationCall = true;
+}
+
+void UDroneReplicationGraphNode_Grid3D::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	AActor* Actor = ActorInfo.GetActor();
+	if (DroneIndices.Contains(Actor))
+	{
+		return;
+	}
+
+	DroneIndices.Add(Actor, Drones.Num());
+
+	FTrackedDrone& Drone = Drones.AddDefaulted_GetRef();
+	Drone.Actor = Actor;
+	Drone.Movement = Actor ? Actor->FindComponentByClass<UDroneMovementComponent>() : nullptr;
+	Drone.Key = Actor;
+}
+
+bool UDroneReplicationGraphNode_Grid3D::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	const AActor* Actor = ActorInfo.GetActor();
+	const int32* Index = DroneIndices.Find(Actor);
+	if (!Index)
+	{
+		UE_CLOG(bWarnIfNotFound, LogTemp, Warning, TEXT("DroneReplicationGraph: %s was not in the drone grid"), *GetNameSafe(Actor));
+		return false;
+	}
+
+	RemoveDroneAt(*Index);
+	return true;
+}
+
+void UDroneReplicationGraphNode_Grid3D::NotifyResetAllNetworkActors()
+{
+	Drones.Reset();
+	DroneIndices.Reset();
+	Grid.Reset();
+	CellLists.Reset();
+}
+
+void UDroneReplicationGraphNode_Grid3D::RemoveDroneAt(int32 Index)
+{
+	DroneIndices.Remove(Drones[Index].Key);
+
+	const int32 LastIndex = Drones.Num() - 1;
+	if (Index != LastIndex)
+	{
+		Drones[Index] = MoveTemp(Drones[LastIndex]);
+		DroneIndices[Drones[Index].Key] = Index;
+	}
+	Drones.RemoveAt(LastIndex, EAllowShrinking::No);
+}
+
+void UDroneReplicationGraphNode_Grid3D::PrepareForReplication()
+{
+	DRONE_TRACE_SCOPE(UDroneReplicationGraphNode_Grid3D::PrepareForReplication);
+
+	// 죽은 항목 정리 (Remove 알림이 늦는 경우 대비)
+	for (int32 Index = Drones.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Drones[Index].Actor.IsValid())
+		{
+			RemoveDroneAt(Index);
+		}
+	}
+
+	Locations.SetNumUninitialized(Drones.Num(), EAllowShrinking::No);
+	GroundedFlags.SetNumUninitialized(Drones.Num(), EAllowShrinking::No);
+
+	Grid.Reset();
+	for (FActorRepListRefView& List : CellLists)
+	{
+		List.Reset();
+	}
+
+	for (int32 Index = 0; Index < Drones.Num(); ++Index)
+	{
+		AActor* Actor = Drones[Index].Actor.Get();
+		const UDroneMovementComponent* Movement = Drones[Index].Movement.Get();
+
+		Locations[Index] = Actor->GetActorLocation();
+		GroundedFlags[Index] = Movement && Movement->IsGrounded();
+
+		const int32 CellIndex = Grid.Add(Index, Locations[Index]);
+		if (!CellLists.IsValidIndex(CellIndex))
+		{
+			CellLists.SetNum(CellIndex + 1);
+		}
+		CellLists[CellIndex].Add(Actor);
+	}
+
+	// Grid.Reset 이 빈 셀을 지우며 순서를 바꾸므로 남는 목록은 잘라낸다
+	CellLists.SetNum(Grid.GetCells().Num());
+}
+
+void UDroneReplicationGraphNode_Grid3D::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	DRONE_TRACE_SCOPE(UDroneReplicationGraphNode_Grid3D::GatherActorListsForConnection);
+
+	const TArray<FDroneRelevancyGrid::FCell>& Cells = Grid.GetCells();
+	for (int32 CellIndex = 0; CellIndex < Cells.Num(); ++CellIndex)
+	{
+		const FDroneRelevancyGrid::FCell& Cell = Cells[CellIndex];
+
+		bool bInRange = false;
+		for (const FNetViewer& Viewer : Params.Viewers)
+		{
+			bInRange |= Grid.IsCellInRange(Cell, Viewer.ViewLocation);
+		}
+		if (!bInRange)
+		{
+			continue;
+		}
+
+		// 셀 안 드론마다 가장 가까운 시점 기준으로 컬 거리와 복제 주기를 정한다
+		for (const int32 DroneIndex : Cell.Items)
+		{
+			const FVector& Location = Locations[DroneIndex];
+			const bool bGrounded = GroundedFlags[DroneIndex];
+
+			float CullDistance = 0.f;
+			double NearestDistanceSq = UE_DOUBLE_BIG_NUMBER;
+			for (const FNetViewer& Viewer : Params.Viewers)
+			{
+				CullDistance = FMath::Max(CullDistance, Grid.GetCullDistance(Location, bGrounded, Viewer.ViewLocation));
+				NearestDistanceSq = FMath::Min(NearestDistanceSq, FVector::DistSquared(Location, Viewer.ViewLocation));
+			}
+
+			FConnectionReplicationActorInfo& ConnectionInfo = Params.ConnectionManager.ActorInfoMap.FindOrAdd(Drones[DroneIndex].Actor.Get());
+			ConnectionInfo.SetCullDistanceSquared(FMath::Square(CullDistance));
+			ConnectionInfo.ReplicationPeriodFrame = static_cast<decltype(ConnectionInfo.ReplicationPeriodFrame)>(Grid.GetReplicationPeriod(FMath::Sqrt(NearestDistanceSq), bGrounded));
+		}
+
+		Params.OutGatheredReplicationLists.AddReplicationActorList(CellLists[CellIndex]);
+	}
+}
+
+void UDroneReplicationGraphNode_AlwaysRelevant_ForConnection::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	ReplicationActorList.Reset();
+
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		ReplicationActorList.ConditionalAdd(Viewer.InViewer);
+		ReplicationActorList.ConditionalAdd(Viewer.ViewTarget);
+
+		// 관전 등으로 뷰 타깃이 바뀌어도 조종 중인 폰은 항상 복제
+		if (const APlayerController* PlayerController = Cast<APlayerController>(Viewer.InViewer))
+		{
+			ReplicationActorList.ConditionalAdd(PlayerController->GetPawn());
+		}
+	}
+
+	Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationActorList);
+}
+
+void UDroneReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	// 공간 관련성은 노드가 정하므로 기본 컬 거리는 끈다
+	FClassReplicationInfo DefaultInfo;
+	DefaultInfo.ReplicationPeriodFrame = 1;
+	DefaultInfo.SetCullDistanceSquared(0.f);
+	GlobalActorReplicationInfoMap.SetClassInfo(AActor::StaticClass(), DefaultInfo);
+
+	// 드론 컬 거리/주기는 격자 노드가 연결마다 덮어쓴다
+	FClassReplicationInfo DroneInfo;
+	DroneInfo.ReplicationPeriodFrame = 1;
+	DroneInfo.SetCullDistanceSquared(0.f);
+	GlobalActorReplicationInfoMap.SetClassInfo(ADronePawn::StaticClass(), DroneInfo);
+}
+
+void UDroneReplicationGraph::InitGlobalGraphNodes()
+{
+	DroneGridNode = CreateNewNode<UDroneReplicationGraphNode_Grid3D>();
+	DroneGridNode->SetSettings(RelevancySettings);
+	AddGlobalGraphNode(DroneGridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+}
+
+void UDroneReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	UDroneReplicationGraphNode_AlwaysRelevant_ForConnection* ConnectionNode = CreateNewNode<UDroneReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(ConnectionNode, RepGraphConnection);
+}
+
+void UDroneReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	AActor* Actor = ActorInfo.GetActor();
+	if (Actor->IsA<ADronePawn>())
+	{
+		DroneGridNode->NotifyAddNetworkActor(ActorInfo);
+	}
+	else if (!IsOwnerOnly(Actor))
+	{
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+	}
+}
+
+void UDroneReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	const AActor* Actor = ActorInfo.GetActor();
+	if (Actor->IsA<ADronePawn>())
+	{
+		DroneGridNode->NotifyRemoveNetworkActor(ActorInfo);
+	}
+	else if (!IsOwnerOnly(Actor))
+	{
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+	}
+}
+
+bool UDroneReplicationGraph::IsOwnerOnly(const AActor* Actor)
+{
+	return Actor->bOnlyRelevantToOwner && !Actor->bAlwaysRelevant;
+}
@@ -0,0 +1,300 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Net/DroneStateCodec.h"
+
+#include "Components/Movement/DroneMovementComponent.h"
+
+namespace
+{
+	// 차분 비트 수 (1~32) 를 담는 길이 필드
+	constexpr int32 DeltaLengthBits = 5;
+
+	int32 BitsForLevels(float Span, float Precision)
+	{
+		const uint32 MaxValue = static_cast<uint32>(FMath::Min(FMath::CeilToDouble(Span / Precision), static_cast<double>(MAX_int32)));
+		return FMath::Clamp(static_cast<int32>(FMath::CeilLogTwo(MaxValue + 1)), 1, 31);
+	}
+
+	uint32 FieldMask(int32 NumBits)
+	{
+		return (1u << NumBits) - 1u;
+	}
+
+	uint32 QuantizeLinear(double Value, double Min, double Precision, int32 NumBits)
+	{
+		const double Levels = FMath::RoundToDouble((Value - Min) / Precision);
+		return static_cast<uint32>(FMath::Clamp(Levels, 0.0, static_cast<double>(FieldMask(NumBits))));
+	}
+
+	uint32 QuantizeRange(float Value, const FFloatInterval& Range, int32 NumBits)
+	{
+		const float Alpha = FMath::Clamp((Value - Range.Min) / FMath::Max(Range.Max - Range.Min, UE_SMALL_NUMBER), 0.f, 1.f);
+		return static_cast<uint32>(FMath::RoundToInt32(Alpha * FieldMask(NumBits)));
+	}
+
+	float DequantizeRange(uint32 Value, const FFloatInterval& Range, int32 NumBits)
+	{
+		return Range.Min + (Range.Max - Range.Min) * (static_cast<float>(Value) / FieldMask(NumBits));
+	}
+
+	// 요는 한 바퀴를 2^Bits 단계로 순환
+	uint32 QuantizeYaw(float Yaw, int32 NumBits)
+	{
+		const double Steps = static_cast<double>(1u << NumBits);
+		return static_cast<uint32>(FMath::RoundToInt64(FRotator::ClampAxis(Yaw) / 360.0 * Steps)) & FieldMask(NumBits);
+	}
+
+	float DequantizeYaw(uint32 Value, int32 NumBits)
+	{
+		return FRotator::NormalizeAxis(static_cast<float>(Value * 360.0 / static_cast<double>(1u << NumBits)));
+	}
+
+	void SerializeField(FArchive& Ar, uint32& Value, int32 NumBits)
+	{
+		if (Ar.IsLoading())
+		{
+			Value = 0;
+		}
+		Ar.SerializeBits(&Value, NumBits);
+	}
+}
+
+int32 FDroneStateQuantization::GetPositionBits() const
+{
+	return BitsForLevels(2.f * PositionExtent, PositionPrecision);
+}
+
+int32 FDroneStateQuantization::GetVelocityBits() const
+{
+	return BitsForLevels(VelocityRange.Max - VelocityRange.Min, VelocityPrecision);
+}
+
+int32 DroneStateCodec::GetFieldBits(const FDroneStateQuantization& Settings, int32 Field)
+{
+	switch (Field)
+	{
+	case FDroneQuantizedState::X:
+	case FDroneQuantizedState::Y:
+	case FDroneQuantizedState::Z:
+		return Settings.GetPositionBits();
+	case FDroneQuantizedState::Yaw:
+		return Settings.YawBits;
+	case FDroneQuantizedState::Pitch:
+	case FDroneQuantizedState::Roll:
+		return Settings.PitchRollBits;
+	case FDroneQuantizedState::ZVelocity:
+		return Settings.GetVelocityBits();
+	default:
+		// Grounded/Flying
+		return 1;
+	}
+}
+
+FDroneQuantizedState DroneStateCodec::Quantize(const FVector& Location, const FRotator& Rotation, float ZVelocity, EDroneMovementMode MovementMode, const FDroneStateQuantization& Settings)
+{
+	const int32 PositionBits = Settings.GetPositionBits();
+
+	FDroneQuantizedState State;
+	State.Values[FDroneQuantizedState::X] = QuantizeLinear(Location.X, -Settings.PositionExtent, Settings.PositionPrecision, PositionBits);
+	State.Values[FDroneQuantizedState::Y] = QuantizeLinear(Location.Y, -Settings.PositionExtent, Settings.PositionPrecision, PositionBits);
+	State.Values[FDroneQuantizedState::Z] = QuantizeLinear(Location.Z, -Settings.PositionExtent, Settings.PositionPrecision, PositionBits);
+	State.Values[FDroneQuantizedState::Yaw] = QuantizeYaw(Rotation.Yaw, Settings.YawBits);
+	State.Values[FDroneQuantizedState::Pitch] = QuantizeRange(FRotator::NormalizeAxis(Rotation.Pitch), Settings.PitchRange, Settings.PitchRollBits);
+	State.Values[FDroneQuantizedState::Roll] = QuantizeRange(FRotator::NormalizeAxis(Rotation.Roll), Settings.RollRange, Settings.PitchRollBits);
+	State.Values[FDroneQuantizedState::ZVelocity] = QuantizeLinear(ZVelocity, Settings.VelocityRange.Min, Settings.VelocityPrecision, Settings.GetVelocityBits());
+	State.Values[FDroneQuantizedState::MovementMode] = MovementMode == EDroneMovementMode::Flying ? 1u : 0u;
+	return State;
+}
+
+void DroneStateCodec::Dequantize(const FDroneQuantizedState& State, const FDroneStateQuantization& Settings, FVector& OutLocation, FRotator& OutRotation, float& OutZVelocity, EDroneMovementMode& OutMovementMode)
+{
+	OutLocation.X = State.Values[FDroneQuantizedState::X] * static_cast<double>(Settings.PositionPrecision) - Settings.PositionExtent;
+	OutLocation.Y = State.Values[FDroneQuantizedState::Y] * static_cast<double>(Settings.PositionPrecision) - Settings.PositionExtent;
+	OutLocation.Z = State.Values[FDroneQuantizedState::Z] * static_cast<double>(Settings.PositionPrecision) - Settings.PositionExtent;
+
+	OutRotation.Yaw = DequantizeYaw(State.Values[FDroneQuantizedState::Yaw], Settings.YawBits);
+	OutRotation.Pitch = DequantizeRange(State.Values[FDroneQuantizedState::Pitch], Settings.PitchRange, Settings.PitchRollBits);
+	OutRotation.Roll = DequantizeRange(State.Values[FDroneQuantizedState::Roll], Settings.RollRange, Settings.PitchRollBits);
+
+	OutZVelocity = Settings.VelocityRange.Min + State.Values[FDroneQuantizedState::ZVelocity] * Settings.VelocityPrecision;
+	OutMovementMode = State.Values[FDroneQuantizedState::MovementMode] != 0 ? EDroneMovementMode::Flying : EDroneMovementMode::Grounded;
+}
+
+void DroneStateCodec::WriteFull(FArchive& Ar, const FDroneQuantizedState& State, const FDroneStateQuantization& Settings)
+{
+	FDroneQuantizedState Copy = State;
+	for (int32 Field = 0; Field < FDroneQuantizedState::NumFields; ++Field)
+	{
+		SerializeField(Ar, Copy.Values[Field], GetFieldBits(Settings, Field));
+	}
+}
+
+void DroneStateCodec::ReadFull(FArchive& Ar, FDroneQuantizedState& OutState, const FDroneStateQuantization& Settings)
+{
+	for (int32 Field = 0; Field < FDroneQuantizedState::NumFields; ++Field)
+	{
+		SerializeField(Ar, OutState.Values[Field], GetFieldBits(Settings, Field));
+	}
+}
+
+void DroneStateCodec::WriteDelta(FArchive& Ar, const FDroneQuantizedState& State, const FDroneQuantizedState& Baseline, const FDroneStateQuantization& Settings)
+{
+	for (int32 Field = 0; Field < FDroneQuantizedState::NumFields; ++Field)
+	{
+		const int32 NumBits = GetFieldBits(Settings, Field);
+
+		// 필드 비트 수 기준 순환 차분을 부호 있는 값으로 (요가 한 바퀴 넘어가도 작은 차분)
+		const uint32 Wrapped = (State.Values[Field] - Baseline.Values[Field]) & FieldMask(NumBits);
+		const int32 Shift = 32 - NumBits;
+		const int32 Delta = static_cast<int32>(Wrapped << Shift) >> Shift;
+
+		uint32 bChanged = Delta != 0 ? 1u : 0u;
+		Ar.SerializeBits(&bChanged, 1);
+		if (!bChanged)
+		{
+			continue;
+		}
+
+		// 지그재그 인코딩 후 최상위 1 비트는 길이로 대신한다
+		uint32 ZigZag = (static_cast<uint32>(Delta) << 1) ^ static_cast<uint32>(Delta >> 31);
+		uint32 Length = FMath::FloorLog2(ZigZag);
+		Ar.SerializeBits(&Length, DeltaLengthBits);
+		SerializeField(Ar, ZigZag, Length);
+	}
+}
+
+void DroneStateCodec::ReadDelta(FArchive& Ar, FDroneQuantizedState& OutState, const FDroneQuantizedState& Baseline, const FDroneStateQuantization& Settings)
+{
+	for (int32 Field = 0; Field < FDroneQuantizedState::NumFields; ++Field)
+	{
+		const uint32 Mask = FieldMask(GetFieldBits(Settings, Field));
+
+		uint32 bChanged = 0;
+		Ar.SerializeBits(&bChanged, 1);
+		if (!bChanged)
+		{
+			OutState.Values[Field] = Baseline.Values[Field];
+			continue;
+		}
+
+		uint32 Length = 0;
+		Ar.SerializeBits(&Length, DeltaLengthBits);
+
+		uint32 ZigZag = 0;
+		SerializeField(Ar, ZigZag, Length);
+		ZigZag |= 1u << Length;
+
+		const int32 Delta = static_cast<int32>(ZigZag >> 1) ^ -static_cast<int32>(ZigZag & 1u);
+		OutState.Values[Field] = (Baseline.Values[Field] + static_cast<uint32>(Delta)) & Mask;
+	}
+}
+
+/** 연결별 델타 기준: 보낸 상태의 식별자와 양자화 값 */
+class FDroneStateDeltaBase : public INetDeltaBaseState
+{
+public:
+	uint16 StateId = 0;
+	FDroneQuantizedState State;
+
+	virtual bool IsStateEqual(INetDeltaBaseState* OtherState) override
+	{
+		return StateId == static_cast<FDroneStateDeltaBase*>(OtherState)->StateId;
+	}
+};
+
+bool FDroneReplicatedState::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+	if (DeltaParms.Writer)
+	{
+		FBitWriter& Writer = *DeltaParms.Writer;
+		const FDroneQuantizedState Current = DroneStateCodec::Quantize(Location, Rotation, ZVelocity, MovementMode, Quantization);
+
+		// 기준과 양자화 값이 같으면 보낼 것이 없다
+		const FDroneStateDeltaBase* OldBase = static_cast<FDroneStateDeltaBase*>(DeltaParms.OldState);
+		if (OldBase && OldBase->State == Current)
+		{
+			return false;
+		}
+
+		TSharedPtr<FDroneStateDeltaBase> NewBase = MakeShared<FDroneStateDeltaBase>();
+		NewBase->StateId = NextStateId;
+		NewBase->State = Current;
+		*DeltaParms.NewState = NewBase;
+
+		NextStateId = NextStateId == MAX_uint16 ? 1 : NextStateId + 1;
+
+		uint32 StateId = NewBase->StateId;
+		Writer.SerializeBits(&StateId, 16);
+
+		uint8 bHasBaseline = OldBase != nullptr ? 1 : 0;
+		Writer.SerializeBits(&bHasBaseline, 1);
+
+		if (OldBase)
+		{
+			uint32 BaselineId = OldBase->StateId;
+			Writer.SerializeBits(&BaselineId, 16);
+			DroneStateCodec::WriteDelta(Writer, Current, OldBase->State, Quantization);
+		}
+		else
+		{
+			DroneStateCodec::WriteFull(Writer, Current, Quantization);
+		}
+		return true;
+	}
+
+	if (DeltaParms.Reader)
+	{
+		FBitReader& Reader = *DeltaParms.Reader;
+
+		uint32 StateId = 0;
+		Reader.SerializeBits(&StateId, 16);
+
+		uint8 bHasBaseline = 0;
+		Reader.SerializeBits(&bHasBaseline, 1);
+
+		FDroneQuantizedState Received;
+		bool bDecoded = true;
+
+		if (bHasBaseline)
+		{
+			uint32 BaselineId = 0;
+			Reader.SerializeBits(&BaselineId, 16);
+
+			const FReceivedState* Baseline = ReceivedHistory.FindByPredicate([BaselineId](const FReceivedState& Entry)
+			{
+				return Entry.StateId == BaselineId;
+			});
+
+			// 기준을 잃었으면 비트만 읽어 넘기고, 보내는 쪽이 확인된 기준으로 다시 보낼 때까지 기다린다
+			bDecoded = Baseline != nullptr;
+			DroneStateCodec::ReadDelta(Reader, Received, Baseline ? Baseline->State : FDroneQuantizedState(), Quantization);
+		}
+		else
+		{
+			DroneStateCodec::ReadFull(Reader, Received, Quantization);
+		}
+
+		if (Reader.IsError() || !bDecoded)
+		{
+			return !Reader.IsError();
+		}
+
+		FReceivedState Entry;
+		Entry.StateId = static_cast<uint16>(StateId);
+		Entry.State = Received;
+		if (ReceivedHistory.Num() < MaxReceivedHistory)
+		{
+			ReceivedHistory.Add(Entry);
+		}
+		else
+		{
+			ReceivedHistory[NextHistoryIndex] = Entry;
+		}
+		NextHistoryIndex = (NextHistoryIndex + 1) % MaxReceivedHistory;
+
+		DroneStateCodec::Dequantize(Received, Quantization, Location, Rotation, ZVelocity, MovementMode);
+		return true;
+	}
+
+	return false;
+}
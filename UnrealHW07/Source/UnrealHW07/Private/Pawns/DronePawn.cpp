@@ -3,22 +3,37 @@
 
 #include "Pawns/DronePawn.h"
 
+#include "DroneStats.h"
 #include "EnhancedInputSubsystems.h"
 #include "HWGameplayTags.h"
 #include "Camera/CameraComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StreamableManager.h"
 #include "Components/SphereComponent.h"
 #include "Components/Camera/DroneCameraComponent.h"
 #include "Components/Input/HWInputComponent.h"
 #include "Data/DataAsset_InputConfig.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Components/Movement/DroneMovementComponent.h"
+#include "Subsystems/DroneSignificanceSubsystem.h"
 
 
+FName ADronePawn::MeshComponentName(TEXT("Mesh"));
+FName ADronePawn::CameraBoomComponentName(TEXT("CameraBoom"));
+FName ADronePawn::FollowCameraComponentName(TEXT("FollowCamera"));
+FName ADronePawn::DroneCameraComponentName(TEXT("DroneCameraComponent"));
+
 // Sets default values
-ADronePawn::ADronePawn()
+ADronePawn::ADronePawn(const FObjectInitializer& ObjectInitializer)
+	: Super(SkipCosmeticSubobjectsOnServer(ObjectInitializer))
 {
 	PrimaryActorTick.bCanEverTick = false;
 
+	// 트랜스폼은 액터 이동 복제 대신 DroneMovement 가 동기화 (프록시는 압축 상태, 조종 클라이언트는 예측/보정)
+	bReplicates = true;
+	SetReplicatingMovement(false);
+
 	bUseControllerRotationPitch = false;
 	bUseControllerRotationYaw   = false;
 	bUseControllerRotationRoll  = false;
@@ -28,25 +43,61 @@ ADronePawn::ADronePawn()
 	SphereRoot->SetSimulatePhysics(false);   
 	SetRootComponent(SphereRoot);
 
-	Mesh = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("Mesh"));
-	Mesh->SetupAttachment(RootComponent);
-	Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	Mesh->SetSimulatePhysics(false);
+	// 외형/카메라 컴포넌트는 선택 서브오브젝트라 데디케이티드 서버에서는 null 이다 (SkipCosmeticSubobjectsOnServer)
+	Mesh = CreateOptionalDefaultSubobject<USkeletalMeshComponent>(MeshComponentName);
+	if (Mesh)
+	{
+		Mesh->SetupAttachment(RootComponent);
+		Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Mesh->SetSimulatePhysics(false);
+	}
 
-	CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
-	CameraBoom->SetupAttachment(RootComponent);
-	CameraBoom->TargetArmLength = DefaultCameraArmLength;
-	CameraBoom->bUsePawnControlRotation = false;
+	CameraBoom = CreateOptionalDefaultSubobject<USpringArmComponent>(CameraBoomComponentName);
+	if (CameraBoom)
+	{
+		CameraBoom->SetupAttachment(RootComponent);
+		CameraBoom->TargetArmLength = DefaultCameraArmLength;
+		CameraBoom->bUsePawnControlRotation = false;
+	}
 
-	FollowCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("FollowCamera"));
-	FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
-	FollowCamera->bUsePawnControlRotation = false;
+	FollowCamera = CreateOptionalDefaultSubobject<UCameraComponent>(FollowCameraComponentName);
+	if (FollowCamera)
+	{
+		FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
+		FollowCamera->bUsePawnControlRotation = false;
+	}
 
-	DroneCameraInterp = CreateDefaultSubobject<UDroneCameraComponent>(TEXT("DroneCameraComponent"));
+	DroneCameraInterp = CreateOptionalDefaultSubobject<UDroneCameraComponent>(DroneCameraComponentName);
 
 	DroneMovement = CreateDefaultSubobject<UDroneMovementComponent>(TEXT("DroneMovementComponent"));
 }
 
+const FObjectInitializer& ADronePawn::SkipCosmeticSubobjectsOnServer(const FObjectInitializer& ObjectInitializer)
+{
+	// 데디케이티드 서버는 이동/충돌만 돌린다. 외형/카메라 컴포넌트를 만들지 않아 드론당 메모리와 스폰 비용을 줄인다.
+	// 클래스 레이아웃(프로퍼티)은 모든 빌드에서 같고 서브오브젝트만 빠지므로, 에디터에서 쿡한 BP 의 템플릿/오버라이드가 그대로 맞는다
+	if (IsRunningDedicatedServer())
+	{
+		ObjectInitializer
+			.DoNotCreateDefaultSubobject(MeshComponentName)
+			.DoNotCreateDefaultSubobject(CameraBoomComponentName)
+			.DoNotCreateDefaultSubobject(FollowCameraComponentName)
+			.DoNotCreateDefaultSubobject(DroneCameraComponentName);
+	}
+	return ObjectInitializer;
+}
+
+void ADronePawn::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// 복제 양자화 범위가 여기서 정해지므로 첫 복제 데이터를 읽기 전에 넘긴다
+	if (DroneMovement)
+	{
+		DroneMovement->SetFlightInputSettings(FlyingSpeedMultiplier, RollSpeed, FlyingPitchRange, FlyingRollRange);
+	}
+}
+
 void ADronePawn::BeginPlay()
 {
 	Super::BeginPlay();
@@ -58,8 +109,152 @@ void ADronePawn::BeginPlay()
 	if (DroneMovement)
 	{
 		DroneMovement->SetGroundDetectionSettings(GroundDetectionOffset, SphereRoot->GetScaledSphereRadius());
+		DroneMovement->AddInterpolatedComponent(Mesh);
+		DroneMovement->AddInterpolatedComponent(CameraBoom);
 		DroneMovement->OnLanded.AddDynamic(this, &ThisClass::HandleLanded);
 		DroneMovement->OnFlying.AddDynamic(this, &ThisClass::HandleFlying);
+		DroneMovement->OnGroundLookPitch.AddDynamic(this, &ThisClass::HandleGroundLookPitch);
+	}
+
+	RequestPawnDataLoad();
+}
+
+void ADronePawn::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (PawnDataHandle.IsValid())
+	{
+		PawnDataHandle->CancelHandle();
+		PawnDataHandle.Reset();
+	}
+	OnPawnDataLoaded.Clear();
+	PendingInputComponent = nullptr;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ADronePawn::RequestPawnDataLoad()
+{
+	TArray<FSoftObjectPath> AssetsToLoad;
+	if (!InputConfigDataAsset.IsNull() && !InputConfigDataAsset.IsValid())
+	{
+		AssetsToLoad.Add(InputConfigDataAsset.ToSoftObjectPath());
+	}
+
+	// 메시 컴포넌트가 없는 서버 타깃은 메시를 로드하지 않는다
+	if (Mesh && !DroneMeshAsset.IsNull() && !DroneMeshAsset.IsValid())
+	{
+		AssetsToLoad.Add(DroneMeshAsset.ToSoftObjectPath());
+	}
+
+	if (AssetsToLoad.IsEmpty())
+	{
+		HandlePawnDataLoaded();
+		return;
+	}
+
+	// 같은 에셋을 쓰는 드론들의 요청은 스트리머블 매니저가 하나로 합친다
+	PawnDataHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		AssetsToLoad, FStreamableDelegate::CreateUObject(this, &ThisClass::HandlePawnDataLoaded), FStreamableManager::AsyncLoadHighPriority);
+}
+
+void ADronePawn::HandlePawnDataLoaded()
+{
+	bPawnDataLoaded = true;
+
+	// 핸들은 EndPlay 에서 취소되므로 이후의 재빙의/풀 재사용은 이 참조로 버틴다
+	LoadedInputConfig = InputConfigDataAsset.Get();
+	LoadedDroneMesh = Mesh ? DroneMeshAsset.Get() : nullptr;
+
+	if (Mesh && LoadedDroneMesh)
+	{
+		Mesh->SetSkeletalMeshAsset(LoadedDroneMesh);
+	}
+
+	if (UHWInputComponent* HWInputComponent = PendingInputComponent)
+	{
+		PendingInputComponent = nullptr;
+
+		// 로드 중에 조종 주체가 바뀌었으면 새 입력 컴포넌트가 다시 요청한다
+		if (InputComponent == HWInputComponent)
+		{
+			SetupDroneInput(HWInputComponent);
+		}
+	}
+
+	OnPawnDataLoaded.Broadcast();
+	OnPawnDataLoaded.Clear();
+}
+
+void ADronePawn::CallOrRegister_OnPawnDataLoaded(FSimpleDelegate&& Delegate)
+{
+	if (bPawnDataLoaded)
+	{
+		Delegate.Execute();
+	}
+	else
+	{
+		OnPawnDataLoaded.Add(MoveTemp(Delegate));
+	}
+}
+
+void ADronePawn::NotifyControllerChanged()
+{
+	Super::NotifyControllerChanged();
+
+	// 조종 주체가 바뀌면 이전 클라이언트의 무브 기록은 의미가 없다
+	if (DroneMovement)
+	{
+		DroneMovement->ResetNetPrediction();
+	}
+
+	// 조종 여부가 바뀌면 중요도 단계를 바로 다시 평가 (카메라 갱신 등)
+	if (UDroneSignificanceSubsystem* SignificanceSubsystem = UWorld::GetSubsystem<UDroneSignificanceSubsystem>(GetWorld()))
+	{
+		SignificanceSubsystem->RequestEvaluation();
+	}
+}
+
+void ADronePawn::ReleaseToPool()
+{
+	if (AController* CurrentController = GetController())
+	{
+		CurrentController->UnPossess();
+	}
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+
+	if (DroneMovement)
+	{
+		DroneMovement->SetPooled(true);
+	}
+	if (DroneCameraInterp)
+	{
+		DroneCameraInterp->StopCameraInterpolation();
+	}
+
+	// 숨김 상태를 한 번 복제한 뒤 재사용될 때까지 복제하지 않는다
+	ForceNetUpdate();
+	SetNetDormancy(DORM_DormantAll);
+}
+
+void ADronePawn::ActivateFromPool(const FVector& Location, const FRotator& Rotation)
+{
+	SetNetDormancy(DORM_Awake);
+
+	// 반납 중에 옮겨야 슬립/지연 보상 기록이 순간이동을 이동으로 보지 않는다
+	SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	if (DroneMovement)
+	{
+		DroneMovement->SetPooled(false);
+	}
+	if (DroneCameraInterp)
+	{
+		DroneCameraInterp->StopCameraInterpolation();
+		DroneCameraInterp->ResetCamera();
 	}
 }
 
@@ -67,74 +262,100 @@ void ADronePawn::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent
 {
 	Super::SetupPlayerInputComponent(PlayerInputComponent);
 
-	checkf(InputConfigDataAsset, TEXT("Forgot to assign a valid data asset as input config"));
+	// 입력 설정이 아직 로드 중이면 바인딩을 로드 완료 시점으로 미룬다
+	UHWInputComponent* HWInputComponent = CastChecked<UHWInputComponent>(PlayerInputComponent);
+	if (!bPawnDataLoaded)
+	{
+		PendingInputComponent = HWInputComponent;
+		return;
+	}
 
-	const ULocalPlayer* LocalPlayer = GetController<APlayerController>()->GetLocalPlayer();
+	SetupDroneInput(HWInputComponent);
+}
 
-	UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(LocalPlayer);
+void ADronePawn::SetupDroneInput(UHWInputComponent* HWInputComponent)
+{
+	// 입력 설정을 지정하지 않았거나 로드에 실패한 변형은 입력 없이 남는다
+	if (!LoadedInputConfig)
+	{
+		UE_LOG(LogTemp, Error, TEXT("DronePawn: failed to load input config '%s'"), *InputConfigDataAsset.ToString());
+		return;
+	}
 
-	check(Subsystem);
-	Subsystem->ClearAllMappings();
-	Subsystem->AddMappingContext(InputConfigDataAsset->DefaultMappingContext, 0);
+	// 봇 컨트롤러에는 로컬 플레이어가 없다 (입력은 주입으로 들어오므로 매핑 컨텍스트가 필요 없음)
+	const APlayerController* PlayerController = GetController<APlayerController>();
+	if (const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr)
+	{
+		UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(LocalPlayer);
 
-	UHWInputComponent* HWInputComponent = CastChecked<UHWInputComponent>(PlayerInputComponent);
+		check(Subsystem);
+		Subsystem->ClearAllMappings();
+		Subsystem->AddMappingContext(LoadedInputConfig->DefaultMappingContext, 0);
+	}
 
-	HWInputComponent->BindNativeInputAction(InputConfigDataAsset, HWGameplayTags::InputTag_Move, ETriggerEvent::Triggered, this, &ThisClass::Input_Move);
-	HWInputComponent->BindNativeInputAction(InputConfigDataAsset, HWGameplayTags::InputTag_Look, ETriggerEvent::Triggered, this, &ThisClass::Input_Look);
-	HWInputComponent->BindNativeInputAction(InputConfigDataAsset, HWGameplayTags::InputTag_Elevate, ETriggerEvent::Started, this, &ThisClass::Input_ElevateStarted);
-	HWInputComponent->BindNativeInputAction(InputConfigDataAsset, HWGameplayTags::InputTag_Elevate, ETriggerEvent::Triggered, this, &ThisClass::Input_Elevate);
-	HWInputComponent->BindNativeInputAction(InputConfigDataAsset, HWGameplayTags::InputTag_Elevate, ETriggerEvent::Completed, this, &ThisClass::Input_ElevateReleased);
-	HWInputComponent->BindNativeInputAction(InputConfigDataAsset, HWGameplayTags::InputTag_Roll, ETriggerEvent::Triggered, this, &ThisClass::Input_Roll);
+	BindInputActions(HWInputComponent);
+}
+
+void ADronePawn::BindInputActions(UHWInputComponent* HWInputComponent)
+{
+	const UDataAsset_InputConfig* InputConfig = LoadedInputConfig;
+	checkf(InputConfig, TEXT("BindInputActions called before the input config finished loading"));
+
+	HWInputComponent->BindNativeInputAction(InputConfig, HWGameplayTags::InputTag_Move, ETriggerEvent::Triggered, this, &ThisClass::Input_Move);
+	HWInputComponent->BindNativeInputAction(InputConfig, HWGameplayTags::InputTag_Look, ETriggerEvent::Triggered, this, &ThisClass::Input_Look);
+	HWInputComponent->BindNativeInputAction(InputConfig, HWGameplayTags::InputTag_Elevate, ETriggerEvent::Started, this, &ThisClass::Input_ElevateStarted);
+	HWInputComponent->BindNativeInputAction(InputConfig, HWGameplayTags::InputTag_Elevate, ETriggerEvent::Triggered, this, &ThisClass::Input_Elevate);
+	HWInputComponent->BindNativeInputAction(InputConfig, HWGameplayTags::InputTag_Elevate, ETriggerEvent::Completed, this, &ThisClass::Input_ElevateReleased);
+	HWInputComponent->BindNativeInputAction(InputConfig, HWGameplayTags::InputTag_Roll, ETriggerEvent::Triggered, this, &ThisClass::Input_Roll);
 }
 
 void ADronePawn::Input_Move(const FInputActionValue& InputActionValue)
 {
-	const FVector2D InputValue = InputActionValue.Get<FVector2D>();
-	if (InputValue.IsNearlyZero()) return;
+	DRONE_SCOPE_CYCLE_COUNTER(STAT_DroneInput, Input);
+	DRONE_TRACE_SCOPE(ADronePawn::Input_Move);
 
-	const float DeltaTime = GetWorld()->GetDeltaSeconds();
-	const float SpeedMultiplier = (DroneMovement && DroneMovement->IsFlight()) ? FlyingSpeedMultiplier : 1.0f;
+	const FVector2D InputValue = InputActionValue.Get<FVector2D>();
+	if (!DroneMovement || InputValue.IsNearlyZero()) return;
 
-	DroneMovement->AddMovementInput(InputValue, DeltaTime, SpeedMultiplier);
+	DroneMovement->EditInputCommand().Move = InputValue;
 }
 
 void ADronePawn::Input_Look(const FInputActionValue& InputActionValue)
 {
+	DRONE_SCOPE_CYCLE_COUNTER(STAT_DroneInput, Input);
+	DRONE_TRACE_SCOPE(ADronePawn::Input_Look);
+
 	const FVector2D InputValue = InputActionValue.Get<FVector2D>();
-	if (InputValue.IsNearlyZero()) return;
+	if (!DroneMovement || InputValue.IsNearlyZero()) return;
 
 	const float YawDelta = InputValue.X * LookSensitivity;       
 	const float PitchDelta = -InputValue.Y * LookSensitivity;   
 
-	if (DroneMovement && DroneMovement->IsGrounded())
-	{
-		AddActorLocalRotation(FRotator(0.f, YawDelta, 0.f));
-
-		if (DroneCameraInterp && !DroneCameraInterp->IsCameraInterpolating())
-		{
-			DroneCameraInterp->SetCameraPitchClamped(PitchDelta, GroundCameraPitchRange.Min, GroundCameraPitchRange.Max);
-		}
-	}
-	else if (DroneMovement && DroneMovement->IsFlight())
-	{
-		DroneMovement->AddRotationInput(YawDelta, PitchDelta, 0.f, FlyingPitchRange, FlyingRollRange);
-	}
+	// 지상 카메라 피치도 명령을 소비할 때 OnGroundLookPitch 로 반영된다
+	DroneMovement->EditInputCommand().Look += FVector2D(YawDelta, PitchDelta);
 }
 
 void ADronePawn::Input_ElevateStarted(const FInputActionValue& InputActionValue)
 {
+	DRONE_SCOPE_CYCLE_COUNTER(STAT_DroneInput, Input);
+	DRONE_TRACE_SCOPE(ADronePawn::Input_ElevateStarted);
+
 	if (DroneMovement)
 	{
-		DroneMovement->SetElevatingState(true);
+		FDroneInputCommand& Command = DroneMovement->EditInputCommand();
+		Command.bElevating = true;
 		if (InputActionValue.Get<float>() > 0.f)
 		{
-			DroneMovement->ApplyVelocityReset(InputActionValue.Get<float>());
+			Command.bVelocityReset = true;
 		}
 	}
 }
 
 void ADronePawn::Input_Elevate(const FInputActionValue& InputActionValue)
 {
+	DRONE_SCOPE_CYCLE_COUNTER(STAT_DroneInput, Input);
+	DRONE_TRACE_SCOPE(ADronePawn::Input_Elevate);
+
 	if (!DroneMovement)
 	{
 		return;
@@ -145,42 +366,62 @@ void ADronePawn::Input_Elevate(const FInputActionValue& InputActionValue)
 		return;
 	}
 	
-	const float DeltaTime = GetWorld()->GetDeltaSeconds();
-	DroneMovement->AddThrust(InputValue, DeltaTime);
+	DroneMovement->EditInputCommand().Thrust = InputValue;
 }
 
 void ADronePawn::Input_ElevateReleased(const FInputActionValue& InputActionValue)
 {
+	DRONE_SCOPE_CYCLE_COUNTER(STAT_DroneInput, Input);
+	DRONE_TRACE_SCOPE(ADronePawn::Input_ElevateReleased);
+
 	if (DroneMovement)
 	{
-		DroneMovement->SetElevatingState(false);
+		DroneMovement->EditInputCommand().bElevating = false;
 	}
 }
 
 void ADronePawn::Input_Roll(const FInputActionValue& InputActionValue)
 {
-	if (!DroneMovement || !DroneMovement->IsFlight()) return;
+	DRONE_SCOPE_CYCLE_COUNTER(STAT_DroneInput, Input);
+	DRONE_TRACE_SCOPE(ADronePawn::Input_Roll);
+
+	if (!DroneMovement) return;
 	
 	const float InputValue = InputActionValue.Get<float>();         
 	if (FMath::IsNearlyZero(InputValue)) return;
 
-	const float DeltaTime = GetWorld()->GetDeltaSeconds();       
-	const float RollDelta = InputValue * RollSpeed * DeltaTime;  
-
-	DroneMovement->AddRotationInput(0.f, 0.f, RollDelta, FlyingPitchRange, FlyingRollRange);
+	DroneMovement->EditInputCommand().Roll = InputValue;
 }
 
 void ADronePawn::HandleLanded()
 {
-	if (DroneCameraInterp)
+	// 착지 자세 정리는 시뮬레이션 규칙이므로 카메라 컴포넌트가 없는 서버에서도 적용
+	const FRotator CurrentPawnRotation = DroneMovement ? DroneMovement->GetPendingRotation() : GetActorRotation();
+	const FRotator NewRotation(0.f, CurrentPawnRotation.Yaw, 0.f);
+	if (DroneMovement)
+	{
+		DroneMovement->QueueRotation(NewRotation);
+	}
+	else
 	{
-		const FRotator CurrentPawnRotation = GetActorRotation();
-		const FRotator NewRotation(0.f, CurrentPawnRotation.Yaw, 0.f);
 		SetActorRotation(NewRotation);
+	}
+
+	if (DroneCameraInterp)
+	{
 		DroneCameraInterp->HandleLandingTransition(CurrentPawnRotation);
 	}
 }
 
+void ADronePawn::HandleGroundLookPitch(float PitchDelta)
+{
+	// 지상에서의 피치는 드론이 아닌 카메라만 움직인다
+	if (DroneCameraInterp && !DroneCameraInterp->IsCameraInterpolating())
+	{
+		DroneCameraInterp->SetCameraPitchClamped(PitchDelta, GroundCameraPitchRange.Min, GroundCameraPitchRange.Max);
+	}
+}
+
 void ADronePawn::HandleFlying()
 {
 	if (DroneCameraInterp)
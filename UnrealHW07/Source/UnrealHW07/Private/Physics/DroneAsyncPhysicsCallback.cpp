@@ -0,0 +1,109 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Physics/DroneAsyncPhysicsCallback.h"
+
+#include "Data/DroneHeightField.h"
+#include "Physics/DroneKinematics.h"
+
+void FDroneAsyncPhysicsCallback::OnPreSimulate_Internal()
+{
+	const float DeltaTime = GetDeltaTime_Internal();
+
+	// 새 입력이 있으면 반영, 없으면 마지막 입력을 유지 (추력 등은 누르고 있는 값)
+	if (const FDroneAsyncPhysicsInput* Input = GetConsumerInput_Internal())
+	{
+		for (const uint32 RemovedId : Input->RemovedDroneIds)
+		{
+			States.Remove(RemovedId);
+		}
+
+		LatestDrones = Input->Drones;
+		HeightField = Input->HeightField;
+
+		for (const FDroneAsyncPhysicsDroneInput& Drone : LatestDrones)
+		{
+			FDroneState* State = States.Find(Drone.DroneId);
+			if (!State)
+			{
+				State = &States.Add(Drone.DroneId);
+				State->MovementMode = Drone.InitialMovementMode;
+			}
+
+			State->OffsetSinceInput = 0.0;
+			if (Drone.bOverrideVelocity)
+			{
+				State->ZVelocity = Drone.OverrideVelocity;
+			}
+		}
+	}
+
+	FDroneAsyncPhysicsOutput& Output = GetProducerOutputData_Internal();
+	Output.Drones.Reset(LatestDrones.Num());
+
+	for (const FDroneAsyncPhysicsDroneInput& Drone : LatestDrones)
+	{
+		FDroneState* State = States.Find(Drone.DroneId);
+		if (!State)
+		{
+			continue;
+		}
+
+		FDroneAsyncPhysicsDroneOutput& DroneOutput = Output.Drones.AddDefaulted_GetRef();
+		DroneOutput.DroneId = Drone.DroneId;
+		DroneOutput.OffsetZ = StepDrone(Drone, *State, DeltaTime);
+		DroneOutput.ZVelocity = State->ZVelocity;
+		DroneOutput.MovementMode = State->MovementMode;
+	}
+}
+
+float FDroneAsyncPhysicsCallback::StepDrone(const FDroneAsyncPhysicsDroneInput& Drone, FDroneState& State, float DeltaTime) const
+{
+	const double CurrentZ = Drone.Location.Z + State.OffsetSinceInput;
+
+	// 지면 접촉: 높이 캐시 우선, 없으면 게임 스레드 프로브 결과
+	double GroundZ = Drone.GroundZ;
+	bool bHasGround = Drone.bHasGround;
+
+	float SampledGroundZ = 0.f;
+	if (HeightField && HeightField->SampleHeight(Drone.Location.X, Drone.Location.Y, SampledGroundZ) && CurrentZ >= SampledGroundZ)
+	{
+		GroundZ = SampledGroundZ;
+		bHasGround = true;
+	}
+
+	// UDroneMovementComponent::UpdateMovementState 와 동일한 전환 규칙
+	if (bHasGround)
+	{
+		const bool bOnLanded = CurrentZ - GroundZ <= Drone.GroundDetectionLength;
+		switch (DroneKinematics::ResolveTransition(State.MovementMode == EDroneMovementMode::Flying, bOnLanded, Drone.bElevating))
+		{
+		case EDroneKinematicsTransition::Land:
+			State.MovementMode = EDroneMovementMode::Grounded;
+			State.ZVelocity = 0.f;
+			break;
+		case EDroneKinematicsTransition::TakeOff:
+			State.MovementMode = EDroneMovementMode::Flying;
+			break;
+		default:
+			break;
+		}
+	}
+
+	// 추력 → 중력 → 수직 이동
+	FDroneKinematicsParams Params;
+	Params.GravityZ = Drone.GravityZ;
+	Params.MaxFallingSpeed = Drone.MaxFallingSpeed;
+	Params.MaxAscendingSpeed = Drone.MaxAscendingSpeed;
+	Params.ThrustAccelZ = Drone.ThrustAccelZ;
+
+	FDroneKinematicsState KinematicsState;
+	KinematicsState.ZVelocity = State.ZVelocity;
+	KinematicsState.bFlying = State.MovementMode == EDroneMovementMode::Flying;
+
+	const float OffsetZ = DroneKinematics::Step(KinematicsState, Drone.ThrustAxis * DeltaTime, DeltaTime, Params);
+	State.ZVelocity = KinematicsState.ZVelocity;
+
+	State.OffsetSinceInput += OffsetZ;
+	return OffsetZ;
+}
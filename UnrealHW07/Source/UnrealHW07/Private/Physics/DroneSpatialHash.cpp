@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Physics/DroneSpatialHash.h"
+
+#include "Async/ParallelFor.h"
+#include "DroneStats.h"
+
+namespace DroneSpatialHash
+{
+	// 버킷 키 계산 청크 크기
+	constexpr int32 ChunkSize = 1024;
+
+	// 항목 수 대비 버킷 수 (충돌을 줄이도록 2배 이상의 2의 거듭제곱)
+	constexpr int32 BucketsPerItem = 2;
+	constexpr int32 MinBuckets = 64;
+}
+
+void FDroneSpatialHash::Reset()
+{
+	ItemBuckets.Reset();
+	BucketStart.Reset();
+	WriteCursor.Reset();
+	SortedItems.Reset();
+	SortedPositions.Reset();
+}
+
+void FDroneSpatialHash::Build(TConstArrayView<FVector> Positions, float InCellSize)
+{
+	DRONE_TRACE_SCOPE(FDroneSpatialHash::Build);
+
+	const int32 Num = Positions.Num();
+	InvCellSize = 1.0 / FMath::Max(InCellSize, 1.f);
+
+	const uint32 NumBuckets = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(Num * DroneSpatialHash::BucketsPerItem, DroneSpatialHash::MinBuckets)));
+	BucketMask = NumBuckets - 1;
+
+	ItemBuckets.SetNumUninitialized(Num, EAllowShrinking::No);
+	BucketStart.SetNumUninitialized(NumBuckets + 1, EAllowShrinking::No);
+	FMemory::Memzero(BucketStart.GetData(), BucketStart.Num() * sizeof(int32));
+	SortedItems.SetNumUninitialized(Num, EAllowShrinking::No);
+	SortedPositions.SetNumUninitialized(Num, EAllowShrinking::No);
+
+	if (Num == 0)
+	{
+		return;
+	}
+
+	// 1) 버킷 키: 항목마다 독립이므로 병렬
+	const int32 NumChunks = FMath::DivideAndRoundUp(Num, DroneSpatialHash::ChunkSize);
+	ParallelFor(NumChunks, [this, Positions, Num](int32 ChunkIndex)
+	{
+		const int32 Begin = ChunkIndex * DroneSpatialHash::ChunkSize;
+		const int32 End = FMath::Min(Begin + DroneSpatialHash::ChunkSize, Num);
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			const FIntVector Cell = GetCellCoord(Positions[Index]);
+			ItemBuckets[Index] = HashCell(Cell.X, Cell.Y, Cell.Z);
+		}
+	}, NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+	// 2) 카운팅 정렬: 버킷별 개수 → 누적합으로 시작 위치
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		++BucketStart[ItemBuckets[Index] + 1];
+	}
+	for (uint32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+	{
+		BucketStart[Bucket + 1] += BucketStart[Bucket];
+	}
+
+	// 3) 같은 버킷의 항목을 연속 배치 (입력 순서 유지)
+	WriteCursor.SetNumUninitialized(NumBuckets, EAllowShrinking::No);
+	FMemory::Memcpy(WriteCursor.GetData(), BucketStart.GetData(), NumBuckets * sizeof(int32));
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		const int32 SortedIndex = WriteCursor[ItemBuckets[Index]]++;
+		SortedItems[SortedIndex] = Index;
+		SortedPositions[SortedIndex] = Positions[Index];
+	}
+}
@@ -0,0 +1,204 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/DroneAvoidanceSubsystem.h"
+
+#include "Async/ParallelFor.h"
+#include "Components/Movement/DroneMovementComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "DroneStats.h"
+#include "Physics/DroneAvoidance.h"
+
+static TAutoConsoleVariable<bool> CVarDroneAvoidanceEnable(
+	TEXT("drone.Avoidance.Enable"),
+	true,
+	TEXT("Blend drone-to-drone separation and predictive avoidance steering into drone movement. While enabled, steered flying drones ignore each other in movement sweeps."));
+
+namespace DroneAvoidanceBatch
+{
+	// 조향 계산 청크 크기
+	constexpr int32 ChunkSize = 256;
+}
+
+bool UDroneAvoidanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDroneAvoidanceSubsystem::Deinitialize()
+{
+	Drones.Empty();
+	Positions.Empty();
+	PreviousPositions.Empty();
+	Velocities.Empty();
+	Steering.Empty();
+	SpatialHash.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UDroneAvoidanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDroneAvoidanceSubsystem, STATGROUP_Tickables);
+}
+
+bool UDroneAvoidanceSubsystem::IsAvoidanceEnabled() const
+{
+	return CVarDroneAvoidanceEnable.GetValueOnGameThread();
+}
+
+void UDroneAvoidanceSubsystem::RegisterDrone(UDroneMovementComponent* Drone)
+{
+	if (!Drone || !Drone->UpdatedComponent || Drones.Contains(Drone))
+	{
+		return;
+	}
+
+	// 첫 프레임 속도가 0 이 되도록 현재 위치를 이전 위치로
+	const FVector Location = Drone->UpdatedComponent->GetComponentLocation();
+	Drones.Add(Drone);
+	Positions.Add(Location);
+	PreviousPositions.Add(Location);
+	Velocities.Add(FVector::ZeroVector);
+	Steering.Add(FVector::ZeroVector);
+}
+
+void UDroneAvoidanceSubsystem::UnregisterDrone(UDroneMovementComponent* Drone)
+{
+	const int32 Index = Drones.Find(Drone);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	Drone->AvoidanceVelocity = FVector::ZeroVector;
+	SetDroneSweepsIgnored(Drone, false);
+
+	Drones.RemoveAtSwap(Index, EAllowShrinking::No);
+	Positions.RemoveAtSwap(Index, EAllowShrinking::No);
+	PreviousPositions.RemoveAtSwap(Index, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, EAllowShrinking::No);
+	Steering.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void UDroneAvoidanceSubsystem::SetDroneSweepsIgnored(UDroneMovementComponent* Drone, bool bIgnore)
+{
+	UPrimitiveComponent* Primitive = Drone ? Drone->UpdatedPrimitive : nullptr;
+	if (!Primitive || Drone->bAvoidanceSweepsIgnored == bIgnore)
+	{
+		return;
+	}
+
+	// 상대 드론도 SteeredDroneChannel 일 때만 서로 무시한다 (Pawn 으로 남은 플레이어 드론과는 양쪽 모두 막힌다)
+	Drone->bAvoidanceSweepsIgnored = bIgnore;
+	if (bIgnore)
+	{
+		Drone->AvoidanceRestoreObjectType = Primitive->GetCollisionObjectType();
+		Primitive->SetCollisionObjectType(SteeredDroneChannel);
+		Primitive->SetCollisionResponseToChannel(SteeredDroneChannel, ECR_Ignore);
+	}
+	else
+	{
+		Primitive->SetCollisionObjectType(Drone->AvoidanceRestoreObjectType);
+		Primitive->SetCollisionResponseToChannel(SteeredDroneChannel, ECR_Block);
+	}
+}
+
+void UDroneAvoidanceSubsystem::UpdateSweepCollision(bool bEnabled)
+{
+	// 이착륙과 빙의로 조향 대상이 바뀌므로 매 프레임 확인한다 (바뀐 드론만 충돌 설정을 건드린다)
+	for (UDroneMovementComponent* Drone : Drones)
+	{
+		if (Drone)
+		{
+			SetDroneSweepsIgnored(Drone, bEnabled && bIgnoreDroneSweeps && Drone->ShouldApplyAvoidance());
+		}
+	}
+}
+
+void UDroneAvoidanceSubsystem::Tick(float DeltaTime)
+{
+	if (!IsAvoidanceEnabled())
+	{
+		// 끈 직후 한 번 남은 조향을 비우고 드론끼리 다시 막히게 한다
+		if (bSteeringApplied)
+		{
+			Steering.Init(FVector::ZeroVector, Drones.Num());
+			ApplySteering();
+			UpdateSweepCollision(false);
+			bSteeringApplied = false;
+		}
+		return;
+	}
+
+	if (Drones.IsEmpty() || DeltaTime <= 0.f)
+	{
+		return;
+	}
+
+	DRONE_TRACE_SCOPE(UDroneAvoidanceSubsystem::Tick);
+
+	UpdateSweepCollision(true);
+	GatherState(DeltaTime);
+	SpatialHash.Build(Positions, NeighborRadius);
+	ComputeSteering();
+	ApplySteering();
+	bSteeringApplied = true;
+}
+
+void UDroneAvoidanceSubsystem::GatherState(float DeltaTime)
+{
+	DRONE_TRACE_SCOPE(UDroneAvoidanceSubsystem::GatherState);
+
+	// 속도는 프레임 간 위치 차이로 구한다 (회피 이동도 포함, 꺼져 있다 다시 켠 첫 프레임은 0)
+	const float InvDeltaTime = 1.f / DeltaTime;
+	for (int32 Index = 0; Index < Drones.Num(); ++Index)
+	{
+		const UDroneMovementComponent* Drone = Drones[Index];
+		if (Drone && Drone->UpdatedComponent)
+		{
+			Positions[Index] = Drone->UpdatedComponent->GetComponentLocation();
+		}
+
+		Velocities[Index] = bSteeringApplied ? (Positions[Index] - PreviousPositions[Index]) * InvDeltaTime : FVector::ZeroVector;
+		PreviousPositions[Index] = Positions[Index];
+	}
+}
+
+void UDroneAvoidanceSubsystem::ComputeSteering()
+{
+	DRONE_TRACE_SCOPE(UDroneAvoidanceSubsystem::ComputeSteering);
+
+	FDroneAvoidanceParams Params;
+	Params.NeighborRadius = NeighborRadius;
+	Params.SeparationRadius = SeparationRadius;
+	Params.SeparationStrength = SeparationStrength;
+	Params.AvoidanceRadius = AvoidanceRadius;
+	Params.LookAheadTime = LookAheadTime;
+	Params.AvoidanceStrength = AvoidanceStrength;
+	Params.MaxSpeed = MaxAvoidanceSpeed;
+
+	// 공간 해시와 위치/속도는 읽기 전용이고 드론마다 자기 슬롯에만 쓰므로 병렬로 안전하다
+	const int32 Num = Drones.Num();
+	const int32 NumChunks = FMath::DivideAndRoundUp(Num, DroneAvoidanceBatch::ChunkSize);
+
+	ParallelFor(NumChunks, [this, &Params, Num](int32 ChunkIndex)
+	{
+		const int32 Begin = ChunkIndex * DroneAvoidanceBatch::ChunkSize;
+		const int32 End = FMath::Min(Begin + DroneAvoidanceBatch::ChunkSize, Num);
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			Steering[Index] = DroneAvoidance::ComputeSteering(SpatialHash, Index, Positions, Velocities, Params);
+		}
+	}, NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void UDroneAvoidanceSubsystem::ApplySteering()
+{
+	for (int32 Index = 0; Index < Drones.Num(); ++Index)
+	{
+		if (UDroneMovementComponent* Drone = Drones[Index])
+		{
+			Drone->AvoidanceVelocity = Steering[Index];
+		}
+	}
+}
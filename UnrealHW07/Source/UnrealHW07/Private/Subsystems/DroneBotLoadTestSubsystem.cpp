@@ -0,0 +1,299 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/DroneBotLoadTestSubsystem.h"
+
+#include "CoreGlobals.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Pawns/DronePawn.h"
+#include "Subsystems/DroneFleetPerfSubsystem.h"
+
+namespace DroneBotLoadTest
+{
+	// "Mixed" 또는 알 수 없는 이름이면 비어 있음
+	TOptional<EDroneBotBehavior> ParseProfile(const FString& Name)
+	{
+		const int64 Value = StaticEnum<EDroneBotBehavior>()->GetValueByNameString(Name);
+		return Value == INDEX_NONE ? TOptional<EDroneBotBehavior>() : TOptional<EDroneBotBehavior>(static_cast<EDroneBotBehavior>(Value));
+	}
+
+	double Percentile(TArray<double>& SortedValues, double Fraction)
+	{
+		if (SortedValues.IsEmpty())
+		{
+			return 0.0;
+		}
+		const int32 Index = FMath::Clamp(FMath::CeilToInt32(Fraction * SortedValues.Num()) - 1, 0, SortedValues.Num() - 1);
+		return SortedValues[Index];
+	}
+
+	void StartCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		UDroneBotLoadTestSubsystem* LoadTest = World ? World->GetSubsystem<UDroneBotLoadTestSubsystem>() : nullptr;
+		if (!LoadTest)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("DroneBotLoadTest: no game world to run in"));
+			return;
+		}
+
+		const int32 NumBots = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+		const TOptional<EDroneBotBehavior> Profile = Args.Num() > 1 ? ParseProfile(Args[1]) : TOptional<EDroneBotBehavior>();
+		const double Duration = Args.Num() > 2 ? FCString::Atod(*Args[2]) : 0.0;
+		LoadTest->StartRun(NumBots, Profile, Duration, false);
+	}
+
+	void StopCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		if (UDroneBotLoadTestSubsystem* LoadTest = World ? World->GetSubsystem<UDroneBotLoadTestSubsystem>() : nullptr)
+		{
+			LoadTest->StopRun();
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs DroneBotsStartCommand(
+	TEXT("drone.Bots.Start"),
+	TEXT("Spawn bot-controlled drones driven through injected Enhanced Input and report throughput and tick times periodically to Saved/Profiling/DroneBots. Arguments: bot count (default 100), profile Hover|Patrol|ClimbDive|LandingSpam|Mixed (default Mixed), duration in seconds (default 0 = until drone.Bots.Stop)."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DroneBotLoadTest::StartCommand));
+
+static FAutoConsoleCommandWithWorldAndArgs DroneBotsStopCommand(
+	TEXT("drone.Bots.Stop"),
+	TEXT("Stop the bot load test, write the last report and destroy the bots."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DroneBotLoadTest::StopCommand));
+
+bool UDroneBotLoadTestSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDroneBotLoadTestSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 무인 실행: -DroneBots=1000 [-DroneBotProfile=Mixed] [-DroneBotDuration=3600], 시간이 지나면 종료
+	static bool bStartedFromCommandLine = false;
+	int32 NumBots = 0;
+	if (!bStartedFromCommandLine && InWorld.WorldType == EWorldType::Game && FParse::Value(FCommandLine::Get(), TEXT("DroneBots="), NumBots) && NumBots > 0)
+	{
+		bStartedFromCommandLine = true;
+
+		FString ProfileName;
+		FParse::Value(FCommandLine::Get(), TEXT("DroneBotProfile="), ProfileName);
+
+		double Duration = 3600.0;
+		FParse::Value(FCommandLine::Get(), TEXT("DroneBotDuration="), Duration);
+
+		StartRun(NumBots, DroneBotLoadTest::ParseProfile(ProfileName), Duration, true);
+	}
+}
+
+void UDroneBotLoadTestSubsystem::Deinitialize()
+{
+	Bots.Empty();
+	BotPawns.Empty();
+	bRunning = false;
+
+	Super::Deinitialize();
+}
+
+TStatId UDroneBotLoadTestSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDroneBotLoadTestSubsystem, STATGROUP_Tickables);
+}
+
+void UDroneBotLoadTestSubsystem::StartRun(int32 NumBots, TOptional<EDroneBotBehavior> Profile, double DurationSeconds, bool bInQuitWhenDone)
+{
+	const UDroneFleetPerfSubsystem* PerfSubsystem = GetWorld()->GetSubsystem<UDroneFleetPerfSubsystem>();
+	if (bRunning || NumBots <= 0 || (PerfSubsystem && PerfSubsystem->IsRunning()))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DroneBotLoadTest: already running or a fleet perf run is active"));
+		return;
+	}
+
+	bRunning = true;
+	bQuitWhenDone = bInQuitWhenDone;
+	RunDuration = DurationSeconds;
+
+	ProfileLabel = Profile.IsSet() ? StaticEnum<EDroneBotBehavior>()->GetNameStringByValue(static_cast<int64>(Profile.GetValue())) : TEXT("Mixed");
+
+	SpawnBots(NumBots, Profile);
+
+	CsvFilename = FPaths::ProfilingDir() / TEXT("DroneBots") / FString::Printf(TEXT("DroneBots_%s.csv"), *FDateTime::Now().ToString());
+	FFileHelper::SaveStringToFile(TEXT("Timestamp,Build,Map,Bots,Profile,ElapsedS,Frames,FrameAvgMs,FrameP50Ms,FrameP95Ms,FrameMaxMs,GameThreadAvgMs,MovementAvgMs,MovementPerBotUs,BotUpdatesPerS,InjectedActionsPerS,UsedMemoryMB\n"), *CsvFilename);
+
+	UE_LOG(LogTemp, Display, TEXT("DroneBotLoadTest: %d bots (%s), %s, reporting every %.0f s to %s"),
+		Bots.Num(),
+		*ProfileLabel,
+		RunDuration > 0.0 ? *FString::Printf(TEXT("%.0f s"), RunDuration) : TEXT("until stopped"),
+		ReportInterval,
+		*CsvFilename);
+
+	RunStartSeconds = FPlatformTime::Seconds();
+	IntervalStartSeconds = RunStartSeconds;
+	LastTickSeconds = RunStartSeconds;
+	FrameTimesMs.Reset();
+	GameThreadMsSum = 0.0;
+	MovementMsSum = 0.0;
+	BotUpdates = 0;
+	FDroneFleetPerfCounters::Reset();
+}
+
+void UDroneBotLoadTestSubsystem::StopRun()
+{
+	if (!bRunning)
+	{
+		return;
+	}
+
+	WriteReport();
+	DestroyBots();
+	bRunning = false;
+
+	UE_LOG(LogTemp, Display, TEXT("DroneBotLoadTest: finished, wrote %s"), *CsvFilename);
+
+	if (bQuitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false, TEXT("DroneBotLoadTest"));
+	}
+}
+
+void UDroneBotLoadTestSubsystem::SpawnBots(int32 NumBots, TOptional<EDroneBotBehavior> Profile)
+{
+	UWorld* World = GetWorld();
+
+	UClass* PawnClass = BotPawnClass.IsNull() ? nullptr : BotPawnClass.LoadSynchronous();
+	if (!PawnClass)
+	{
+		PawnClass = ADronePawn::StaticClass();
+	}
+
+	constexpr int32 NumBehaviors = static_cast<int32>(EDroneBotBehavior::LandingSpam) + 1;
+	const int32 GridWidth = FMath::CeilToInt32(FMath::Sqrt(static_cast<float>(NumBots)));
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	for (int32 Index = 0; Index < NumBots; ++Index)
+	{
+		const FVector Location(
+			(Index % GridWidth - GridWidth / 2) * SpawnSpacing,
+			(Index / GridWidth - GridWidth / 2) * SpawnSpacing,
+			SpawnHeight);
+
+		APawn* Pawn = World->SpawnActor<APawn>(PawnClass, Location, FRotator::ZeroRotator, SpawnParameters);
+		ADroneBotController* Bot = Pawn ? World->SpawnActor<ADroneBotController>(SpawnParameters) : nullptr;
+		if (!Bot)
+		{
+			continue;
+		}
+
+		Bot->SetBehavior(Profile.Get(static_cast<EDroneBotBehavior>(Index % NumBehaviors)), Index);
+		Bot->Possess(Pawn);
+
+		Bots.Add(Bot);
+		BotPawns.Add(Pawn);
+	}
+}
+
+void UDroneBotLoadTestSubsystem::DestroyBots()
+{
+	for (ADroneBotController* Bot : Bots)
+	{
+		if (IsValid(Bot))
+		{
+			Bot->Destroy();
+		}
+	}
+	for (APawn* Pawn : BotPawns)
+	{
+		if (IsValid(Pawn))
+		{
+			Pawn->Destroy();
+		}
+	}
+	Bots.Reset();
+	BotPawns.Reset();
+}
+
+void UDroneBotLoadTestSubsystem::Tick(float DeltaTime)
+{
+	if (!bRunning)
+	{
+		return;
+	}
+
+	// 지난 프레임 동안 쌓인 값을 구간에 누적
+	const double NowSeconds = FPlatformTime::Seconds();
+	FrameTimesMs.Add((NowSeconds - LastTickSeconds) * 1000.0);
+	GameThreadMsSum += FPlatformTime::ToMilliseconds(GGameThreadTime);
+	MovementMsSum += FPlatformTime::ToMilliseconds64(FDroneFleetPerfCounters::MovementCycles);
+	BotUpdates += Bots.Num();
+	FDroneFleetPerfCounters::Reset();
+	LastTickSeconds = NowSeconds;
+
+	if (RunDuration > 0.0 && NowSeconds - RunStartSeconds >= RunDuration)
+	{
+		StopRun();
+	}
+	else if (NowSeconds - IntervalStartSeconds >= ReportInterval)
+	{
+		WriteReport();
+	}
+}
+
+void UDroneBotLoadTestSubsystem::WriteReport()
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+	const double IntervalSeconds = FMath::Max(NowSeconds - IntervalStartSeconds, UE_DOUBLE_SMALL_NUMBER);
+	const double NumFrames = FMath::Max(1, FrameTimesMs.Num());
+
+	int64 InjectedActions = 0;
+	for (ADroneBotController* Bot : Bots)
+	{
+		if (IsValid(Bot))
+		{
+			InjectedActions += Bot->ConsumeInjectedActionCount();
+		}
+	}
+
+	double FrameSum = 0.0;
+	for (const double FrameMs : FrameTimesMs)
+	{
+		FrameSum += FrameMs;
+	}
+	FrameTimesMs.Sort();
+
+	const double MovementAvgMs = MovementMsSum / NumFrames;
+	const FString Row = FString::Printf(TEXT("%s,%s,%s,%d,%s,%.0f,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.0f,%.0f,%.1f"),
+		*FDateTime::UtcNow().ToIso8601(),
+		FApp::GetBuildVersion(),
+		*GetWorld()->GetMapName(),
+		Bots.Num(),
+		*ProfileLabel,
+		NowSeconds - RunStartSeconds,
+		FrameTimesMs.Num(),
+		FrameSum / NumFrames,
+		DroneBotLoadTest::Percentile(FrameTimesMs, 0.5),
+		DroneBotLoadTest::Percentile(FrameTimesMs, 0.95),
+		DroneBotLoadTest::Percentile(FrameTimesMs, 1.0),
+		GameThreadMsSum / NumFrames,
+		MovementAvgMs,
+		Bots.Num() > 0 ? MovementAvgMs * 1000.0 / Bots.Num() : 0.0,
+		BotUpdates / IntervalSeconds,
+		InjectedActions / IntervalSeconds,
+		FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0));
+
+	UE_LOG(LogTemp, Display, TEXT("DroneBotLoadTest: %s"), *Row);
+	FFileHelper::SaveStringToFile(Row + TEXT("\n"), *CsvFilename, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+
+	IntervalStartSeconds = NowSeconds;
+	FrameTimesMs.Reset();
+	GameThreadMsSum = 0.0;
+	MovementMsSum = 0.0;
+	BotUpdates = 0;
+}
@@ -0,0 +1,376 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/DroneFleetPerfSubsystem.h"
+
+#include "CoreGlobals.h"
+#include "Components/Movement/DroneMovementComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Pawns/DronePawn.h"
+
+uint64 FDroneFleetPerfCounters::MovementCycles = 0;
+uint64 FDroneFleetPerfCounters::CameraCycles = 0;
+int32 FDroneFleetPerfCounters::GroundTraces = 0;
+
+namespace DroneFleetPerf
+{
+	TArray<int32> ParseFleetSizes(const FString& Text)
+	{
+		TArray<FString> Tokens;
+		Text.ParseIntoArray(Tokens, TEXT(","));
+
+		TArray<int32> Sizes;
+		for (const FString& Token : Tokens)
+		{
+			const int32 Size = FCString::Atoi(*Token);
+			if (Size > 0)
+			{
+				Sizes.Add(Size);
+			}
+		}
+		return Sizes;
+	}
+
+	double Percentile(TArray<double> Values, double Fraction)
+	{
+		if (Values.IsEmpty())
+		{
+			return 0.0;
+		}
+		Values.Sort();
+		const int32 Index = FMath::Clamp(FMath::CeilToInt32(Fraction * Values.Num()) - 1, 0, Values.Num() - 1);
+		return Values[Index];
+	}
+
+	// 서버 타깃과 게임 타깃 결과를 한 CSV 에서 비교할 수 있게 남긴다 (외형 컴포넌트는 데디케이티드 서버 여부로 빠진다)
+	const TCHAR* GetTargetName()
+	{
+		return IsRunningDedicatedServer() ? TEXT("Server") : (UE_EDITOR ? TEXT("Editor") : TEXT("Game"));
+	}
+
+	void RunCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		UDroneFleetPerfSubsystem* PerfSubsystem = World ? World->GetSubsystem<UDroneFleetPerfSubsystem>() : nullptr;
+		if (!PerfSubsystem)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("DroneFleetPerf: no game world to run in"));
+			return;
+		}
+
+		const TArray<int32> Sizes = ParseFleetSizes(Args.Num() > 0 ? Args[0] : TEXT("1,100,1000,5000"));
+		const int32 Frames = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 300;
+		PerfSubsystem->StartRun(Sizes, Frames, false);
+	}
+}
+
+#if DRONE_STATS
+static FAutoConsoleCommandWithWorldAndArgs DroneFleetPerfRunCommand(
+	TEXT("drone.Perf.Run"),
+	TEXT("Spawn scripted drone fleets and write frame, game thread, movement, camera, trace and memory stats to Saved/Profiling/DronePerf. Arguments: comma separated fleet sizes (default 1,100,1000,5000), measured frames per size (default 300)."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DroneFleetPerf::RunCommand));
+#endif
+
+bool UDroneFleetPerfSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// 이동/카메라 카운터가 Shipping 에서는 비어 있으므로 측정하지 않는다
+	return DRONE_STATS && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool UDroneFleetPerfSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDroneFleetPerfSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 무인 실행: -DronePerf=1,100,1000,5000 [-DronePerfFrames=300], 끝나면 종료
+	static bool bStartedFromCommandLine = false;
+	FString SizesArg;
+	if (!bStartedFromCommandLine && InWorld.WorldType == EWorldType::Game && FParse::Value(FCommandLine::Get(), TEXT("DronePerf="), SizesArg))
+	{
+		bStartedFromCommandLine = true;
+
+		int32 Frames = 300;
+		FParse::Value(FCommandLine::Get(), TEXT("DronePerfFrames="), Frames);
+		StartRun(DroneFleetPerf::ParseFleetSizes(SizesArg), FMath::Max(1, Frames), true);
+	}
+}
+
+void UDroneFleetPerfSubsystem::Deinitialize()
+{
+	SpawnedDrones.Empty();
+	SpawnedMovement.Empty();
+	Phase = EPhase::Idle;
+
+	Super::Deinitialize();
+}
+
+TStatId UDroneFleetPerfSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDroneFleetPerfSubsystem, STATGROUP_Tickables);
+}
+
+void UDroneFleetPerfSubsystem::StartRun(const TArray<int32>& InFleetSizes, int32 InMeasureFrames, bool bInQuitWhenDone)
+{
+	if (IsRunning() || InFleetSizes.IsEmpty())
+	{
+		return;
+	}
+
+	FleetSizes = InFleetSizes;
+	FleetIndex = 0;
+	MeasureFrames = InMeasureFrames;
+	bQuitWhenDone = bInQuitWhenDone;
+	ResultRows.Reset();
+
+	UE_LOG(LogTemp, Display, TEXT("DroneFleetPerf: starting %d fleet sizes, %d frames each"), FleetSizes.Num(), MeasureFrames);
+	BeginFleet();
+}
+
+void UDroneFleetPerfSubsystem::BeginFleet()
+{
+	UWorld* World = GetWorld();
+
+	UClass* SpawnClass = DroneClass.IsNull() ? nullptr : DroneClass.LoadSynchronous();
+	if (!SpawnClass)
+	{
+		SpawnClass = ADronePawn::StaticClass();
+	}
+
+	MemoryBeforeSpawn = FPlatformMemory::GetStats().UsedPhysical;
+
+	// 원점 주변 격자에 스폰 (겹쳐도 항상 스폰)
+	const int32 NumDrones = FleetSizes[FleetIndex];
+	const int32 GridWidth = FMath::CeilToInt32(FMath::Sqrt(static_cast<float>(NumDrones)));
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	const double SpawnStartSeconds = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumDrones; ++Index)
+	{
+		const FVector Location(
+			(Index % GridWidth - GridWidth / 2) * SpawnSpacing,
+			(Index / GridWidth - GridWidth / 2) * SpawnSpacing,
+			SpawnHeight);
+
+		if (APawn* Drone = World->SpawnActor<APawn>(SpawnClass, Location, FRotator::ZeroRotator, SpawnParameters))
+		{
+			SpawnedDrones.Add(Drone);
+			SpawnedMovement.Add(Drone->FindComponentByClass<UDroneMovementComponent>());
+		}
+	}
+	SpawnSeconds = FPlatformTime::Seconds() - SpawnStartSeconds;
+
+	// 컴포넌트 객체 크기 + 자체 리소스 크기 (공유 에셋은 빼고 드론마다 늘어나는 부분만)
+	int32 NumComponents = 0;
+	SIZE_T ComponentBytes = 0;
+	for (const APawn* Drone : SpawnedDrones)
+	{
+		TInlineComponentArray<UActorComponent*> Components(Drone);
+		NumComponents += Components.Num();
+		for (UActorComponent* Component : Components)
+		{
+			ComponentBytes += Component->GetClass()->GetStructureSize() + Component->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+		}
+	}
+	const int32 NumSpawned = FMath::Max(1, SpawnedDrones.Num());
+	ComponentsPerDrone = static_cast<double>(NumComponents) / NumSpawned;
+	ComponentKBPerDrone = static_cast<double>(ComponentBytes) / 1024.0 / NumSpawned;
+
+	Phase = EPhase::WarmUp;
+	PhaseFrame = 0;
+	ScriptTime = 0.0;
+	Samples.Reset(MeasureFrames);
+	LastTickSeconds = FPlatformTime::Seconds();
+}
+
+void UDroneFleetPerfSubsystem::EndFleet()
+{
+	const int32 NumDrones = SpawnedDrones.Num();
+
+	TArray<double> FrameTimes;
+	double GameThreadSum = 0.0;
+	int32 GameThreadSamples = 0;
+	double MovementSum = 0.0;
+	double CameraSum = 0.0;
+	int64 TraceSum = 0;
+	for (const FFrameSample& Sample : Samples)
+	{
+		FrameTimes.Add(Sample.FrameMs);
+		if (Sample.GameThreadMs >= 0.0)
+		{
+			GameThreadSum += Sample.GameThreadMs;
+			++GameThreadSamples;
+		}
+		MovementSum += Sample.MovementMs;
+		CameraSum += Sample.CameraMs;
+		TraceSum += Sample.GroundTraces;
+	}
+
+	const double NumSamples = FMath::Max(1, Samples.Num());
+	double FrameSum = 0.0;
+	for (const double FrameMs : FrameTimes)
+	{
+		FrameSum += FrameMs;
+	}
+
+	const double MovementAvgMs = MovementSum / NumSamples;
+	const double MemoryPerDroneKB = NumDrones > 0 ? (static_cast<double>(MemoryAfterWarmUp) - static_cast<double>(MemoryBeforeSpawn)) / 1024.0 / NumDrones : 0.0;
+
+	ResultRows.Add(FString::Printf(TEXT("%s,%s,%s,%s,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.2f,%.2f,%.2f,%.2f,%.2f"),
+		*FDateTime::UtcNow().ToIso8601(),
+		FApp::GetBuildVersion(),
+		DroneFleetPerf::GetTargetName(),
+		*GetWorld()->GetMapName(),
+		NumDrones,
+		Samples.Num(),
+		FrameSum / NumSamples,
+		DroneFleetPerf::Percentile(FrameTimes, 0.5),
+		DroneFleetPerf::Percentile(FrameTimes, 0.95),
+		DroneFleetPerf::Percentile(FrameTimes, 1.0),
+		GameThreadSum / FMath::Max(1, GameThreadSamples),
+		MovementAvgMs,
+		NumDrones > 0 ? MovementAvgMs * 1000.0 / NumDrones : 0.0,
+		CameraSum / NumSamples,
+		TraceSum / NumSamples,
+		MemoryPerDroneKB,
+		ComponentsPerDrone,
+		ComponentKBPerDrone,
+		NumDrones > 0 ? SpawnSeconds * 1.0e6 / NumDrones : 0.0));
+
+	UE_LOG(LogTemp, Display, TEXT("DroneFleetPerf: %s"), *ResultRows.Last());
+
+	for (APawn* Drone : SpawnedDrones)
+	{
+		if (IsValid(Drone))
+		{
+			Drone->Destroy();
+		}
+	}
+	SpawnedDrones.Reset();
+	SpawnedMovement.Reset();
+
+	// 다음 플릿 전에 파괴된 드론을 정리해 메모리 측정이 섞이지 않게 한다
+	GEngine->ForceGarbageCollection(true);
+}
+
+void UDroneFleetPerfSubsystem::FinishRun()
+{
+	Phase = EPhase::Idle;
+	WriteCsv();
+
+	if (bQuitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false, TEXT("DroneFleetPerf"));
+	}
+}
+
+void UDroneFleetPerfSubsystem::WriteCsv()
+{
+	FString Csv = TEXT("Timestamp,Build,Target,Map,Drones,Frames,FrameAvgMs,FrameP50Ms,FrameP95Ms,FrameMaxMs,GameThreadAvgMs,MovementAvgMs,MovementPerDroneUs,CameraAvgMs,TracesPerFrame,MemoryPerDroneKB,ComponentsPerDrone,ComponentKBPerDrone,SpawnPerDroneUs\n");
+	for (const FString& Row : ResultRows)
+	{
+		Csv += Row + TEXT("\n");
+	}
+
+	const FString Filename = FPaths::ProfilingDir() / TEXT("DronePerf") / FString::Printf(TEXT("DroneFleetPerf_%s.csv"), *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(Csv, *Filename))
+	{
+		LastCsvFilename = Filename;
+		UE_LOG(LogTemp, Display, TEXT("DroneFleetPerf: wrote %s"), *Filename);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("DroneFleetPerf: failed to write %s"), *Filename);
+	}
+}
+
+void UDroneFleetPerfSubsystem::DriveFleet()
+{
+	// 드론마다 위상이 다른 추력/원 이동 패턴 (같은 시간이면 항상 같은 입력)
+	for (int32 Index = 0; Index < SpawnedMovement.Num(); ++Index)
+	{
+		if (UDroneMovementComponent* Movement = SpawnedMovement[Index])
+		{
+			const double Time = ScriptTime + Index * 0.37;
+
+			FDroneInputCommand& Command = Movement->EditInputCommand();
+			Command.Thrust = static_cast<float>(FMath::Sin(Time * 0.5));
+			Command.bElevating = Command.Thrust > 0.f;
+			Command.Move = FVector2D(FMath::Cos(Time * 0.3), FMath::Sin(Time * 0.3)) * 0.5;
+			Command.Look = FVector2D(0.2f, 0.f);
+		}
+	}
+}
+
+void UDroneFleetPerfSubsystem::Tick(float DeltaTime)
+{
+	if (Phase == EPhase::Idle)
+	{
+		return;
+	}
+
+	// 이전 플릿의 GC 가 끝난 뒤 다음 플릿 시작
+	if (Phase == EPhase::CoolDown)
+	{
+		if (++PhaseFrame >= CoolDownFrames)
+		{
+			BeginFleet();
+		}
+		return;
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	const double FrameMs = (NowSeconds - LastTickSeconds) * 1000.0;
+	LastTickSeconds = NowSeconds;
+
+	// GGameThreadTime 은 지금 시점에 직전 프레임 값이므로 직전 표본에 넣는다
+	if (Phase == EPhase::Measure && !Samples.IsEmpty() && Samples.Last().GameThreadMs < 0.0)
+	{
+		Samples.Last().GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	}
+
+	// 지난 Tick 이후 쌓인 카운터를 표본으로 남긴다
+	if (Phase == EPhase::Measure && PhaseFrame > 0)
+	{
+		FFrameSample& Sample = Samples.AddDefaulted_GetRef();
+		Sample.FrameMs = FrameMs;
+		Sample.MovementMs = FPlatformTime::ToMilliseconds64(FDroneFleetPerfCounters::MovementCycles);
+		Sample.CameraMs = FPlatformTime::ToMilliseconds64(FDroneFleetPerfCounters::CameraCycles);
+		Sample.GroundTraces = FDroneFleetPerfCounters::GroundTraces;
+	}
+	FDroneFleetPerfCounters::Reset();
+
+	ScriptTime += DeltaTime;
+	DriveFleet();
+	++PhaseFrame;
+
+	if (Phase == EPhase::WarmUp && PhaseFrame >= WarmUpFrames)
+	{
+		MemoryAfterWarmUp = FPlatformMemory::GetStats().UsedPhysical;
+		Phase = EPhase::Measure;
+		PhaseFrame = 0;
+	}
+	else if (Phase == EPhase::Measure && Samples.Num() >= MeasureFrames)
+	{
+		EndFleet();
+
+		if (++FleetIndex < FleetSizes.Num())
+		{
+			Phase = EPhase::CoolDown;
+			PhaseFrame = 0;
+		}
+		else
+		{
+			FinishRun();
+		}
+	}
+}
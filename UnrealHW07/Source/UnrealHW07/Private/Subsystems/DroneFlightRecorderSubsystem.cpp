@@ -0,0 +1,752 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/DroneFlightRecorderSubsystem.h"
+
+#include "Async/MappedFileHandle.h"
+#include "Containers/Queue.h"
+#include "DroneStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Pawns/DronePawn.h"
+#include "Subsystems/DroneAvoidanceSubsystem.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace DroneFlightRecorder
+{
+	constexpr uint32 Magic = 0x52465244; // "DRFR"
+	constexpr uint16 Version = 3;
+
+	// 프레임 레코드의 값 존재/버튼 비트
+	enum EFrameFlags : uint8
+	{
+		HasMove = 1 << 0,
+		HasLook = 1 << 1,
+		HasThrust = 1 << 2,
+		HasRoll = 1 << 3,
+		Elevating = 1 << 4,
+		VelocityReset = 1 << 5,
+		HasCatchUp = 1 << 6,
+		HasAvoidance = 1 << 7
+	};
+
+	FString GetDefaultFilename()
+	{
+		return FPaths::ProfilingDir() / TEXT("DroneFlightLogs") / FString::Printf(TEXT("Flight_%s.drfr"), *FDateTime::Now().ToString());
+	}
+
+	UDroneFlightRecorderSubsystem* GetRecorder(UWorld* World)
+	{
+		UDroneFlightRecorderSubsystem* Recorder = World ? World->GetSubsystem<UDroneFlightRecorderSubsystem>() : nullptr;
+		UE_CLOG(!Recorder, LogTemp, Warning, TEXT("DroneFlightRecorder: no game world"));
+		return Recorder;
+	}
+
+	void StartCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		if (UDroneFlightRecorderSubsystem* Recorder = GetRecorder(World))
+		{
+			Recorder->StartRecording(Args.Num() > 0 ? Args[0] : GetDefaultFilename());
+		}
+	}
+
+	void StopCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		if (UDroneFlightRecorderSubsystem* Recorder = GetRecorder(World))
+		{
+			Recorder->StopRecording();
+		}
+	}
+
+	void ReplayCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		UDroneFlightRecorderSubsystem* Recorder = GetRecorder(World);
+		if (!Recorder || Args.IsEmpty())
+		{
+			UE_CLOG(Recorder != nullptr, LogTemp, Warning, TEXT("DroneFlightRecorder: usage drone.Recorder.Replay <file> [resync 0|1]"));
+			return;
+		}
+
+		FDroneFlightReplayResult Result;
+		Recorder->Replay(Args[0], Args.Num() > 1 && FCString::Atoi(*Args[1]) != 0, Result);
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs DroneRecorderStartCommand(
+	TEXT("drone.Recorder.Start"),
+	TEXT("Start recording drone input commands and state keyframes to a binary flight log. Optional argument: file path (default Saved/Profiling/DroneFlightLogs)."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DroneFlightRecorder::StartCommand));
+
+static FAutoConsoleCommandWithWorldAndArgs DroneRecorderStopCommand(
+	TEXT("drone.Recorder.Stop"),
+	TEXT("Stop recording and flush the flight log."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DroneFlightRecorder::StopCommand));
+
+static FAutoConsoleCommandWithWorldAndArgs DroneRecorderReplayCommand(
+	TEXT("drone.Recorder.Replay"),
+	TEXT("Replay a flight log headless as fast as possible, report divergence against its keyframes and append timing to Saved/Profiling/DroneReplay/DroneReplay.csv. Arguments: file path, resync on keyframes 0|1 (default 0)."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DroneFlightRecorder::ReplayCommand));
+
+/** 기록 스레드: 게임 스레드가 넘긴 프레임 버퍼를 순서대로 파일에 쓴다 */
+class FDroneFlightLogWriter final : public FRunnable
+{
+public:
+	explicit FDroneFlightLogWriter(FArchive* InFile)
+		: File(InFile)
+		, WakeEvent(FPlatformProcess::GetSynchEventFromPool())
+	{
+		Thread = FRunnableThread::Create(this, TEXT("DroneFlightLogWriter"), 0, TPri_BelowNormal);
+	}
+
+	virtual ~FDroneFlightLogWriter() override
+	{
+		bStopping = true;
+		WakeEvent->Trigger();
+		if (Thread)
+		{
+			Thread->WaitForCompletion();
+			delete Thread;
+		}
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+
+		// 스레드가 끝난 뒤 남은 버퍼를 마저 쓴다
+		WriteQueued();
+		File->Close();
+	}
+
+	void Enqueue(TArray<uint8>&& Chunk)
+	{
+		Queue.Enqueue(MoveTemp(Chunk));
+		WakeEvent->Trigger();
+	}
+
+	int64 GetBytesWritten() const { return BytesWritten.load(); }
+
+	// FRunnable 오버라이드
+	virtual uint32 Run() override
+	{
+		while (!bStopping)
+		{
+			WakeEvent->Wait(100);
+			WriteQueued();
+		}
+		return 0;
+	}
+
+private:
+	void WriteQueued()
+	{
+		TArray<uint8> Chunk;
+		while (Queue.Dequeue(Chunk))
+		{
+			File->Serialize(Chunk.GetData(), Chunk.Num());
+			BytesWritten += Chunk.Num();
+		}
+	}
+
+	TUniquePtr<FArchive> File;
+	FEvent* WakeEvent;
+	FRunnableThread* Thread = nullptr;
+	TQueue<TArray<uint8>, EQueueMode::Spsc> Queue;
+	std::atomic<bool> bStopping = false;
+	std::atomic<int64> BytesWritten = 0;
+};
+
+FArchive& operator<<(FArchive& Ar, FDroneFlightKeyframe& Keyframe)
+{
+	uint8 Mode = static_cast<uint8>(Keyframe.MovementMode);
+	uint8 bElevating = Keyframe.bElevating ? 1 : 0;
+
+	uint8 bGroundProbeHit = Keyframe.bGroundProbeHit ? 1 : 0;
+	uint8 bGroundTracePending = Keyframe.bGroundTracePending ? 1 : 0;
+
+	Ar << Keyframe.Location;
+	Ar << Keyframe.Rotation;
+	Ar << Keyframe.ZVelocity;
+	Ar << Mode;
+	Ar << bElevating;
+
+	Ar << Keyframe.FixedStepAccumulator;
+	Ar << Keyframe.InterpolationAlpha;
+	Ar << Keyframe.LastStepOffsetZ;
+	Ar << Keyframe.LastStepHorizontalOffset;
+	Ar << Keyframe.ThrustAxis;
+	Ar << Keyframe.PendingMoveInput;
+
+	Ar << Keyframe.CachedGroundDistance;
+	Ar << bGroundProbeHit;
+	Ar << Keyframe.LastGroundProbeLocation;
+	Ar << bGroundTracePending;
+	if (bGroundTracePending)
+	{
+		Ar << Keyframe.PendingGroundProbeLocation;
+		Ar << Keyframe.PendingGroundProbeLength;
+	}
+
+	Keyframe.MovementMode = static_cast<EDroneMovementMode>(Mode);
+	Keyframe.bElevating = bElevating != 0;
+	Keyframe.bGroundProbeHit = bGroundProbeHit != 0;
+	Keyframe.bGroundTracePending = bGroundTracePending != 0;
+	return Ar;
+}
+
+bool UDroneFlightRecorderSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDroneFlightRecorderSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	KeyframeInterval = FMath::Max(1, KeyframeInterval);
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ThisClass::HandleWorldPostActorTick);
+}
+
+void UDroneFlightRecorderSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	StopRecording();
+
+	Super::Deinitialize();
+}
+
+void UDroneFlightRecorderSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (InWorld.WorldType != EWorldType::Game)
+	{
+		return;
+	}
+
+	// 무인 실행: -DroneRecord=<file> 는 종료까지 기록, -DroneReplay=<file> [-DroneReplayResync] 는 재생 후 종료
+	static bool bHandledCommandLine = false;
+	if (bHandledCommandLine)
+	{
+		return;
+	}
+	bHandledCommandLine = true;
+
+	FString Filename;
+	if (FParse::Value(FCommandLine::Get(), TEXT("DroneRecord="), Filename))
+	{
+		StartRecording(Filename);
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("DroneReplay="), Filename))
+	{
+		FDroneFlightReplayResult Result;
+		Replay(Filename, FParse::Param(FCommandLine::Get(), TEXT("DroneReplayResync")), Result);
+		FPlatformMisc::RequestExit(false, TEXT("DroneFlightRecorder"));
+	}
+}
+
+bool UDroneFlightRecorderSubsystem::StartRecording(const FString& Filename)
+{
+	if (IsRecording() || bReplaying)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DroneFlightRecorder: already recording or replaying"));
+		return false;
+	}
+
+	FArchive* File = IFileManager::Get().CreateFileWriter(*Filename);
+	if (!File)
+	{
+		UE_LOG(LogTemp, Error, TEXT("DroneFlightRecorder: failed to open %s"), *Filename);
+		return false;
+	}
+
+	RecordingFilename = Filename;
+	RecordedDrones.Reset();
+	SkippedDrones.Reset();
+	NextDroneId = 1;
+
+	FrameBuffer.Reset();
+	FMemoryWriter Ar(FrameBuffer);
+	uint32 Magic = DroneFlightRecorder::Magic;
+	uint16 Version = DroneFlightRecorder::Version;
+	Ar << Magic;
+	Ar << Version;
+
+	Writer = MakeShared<FDroneFlightLogWriter>(File);
+
+	UE_LOG(LogTemp, Display, TEXT("DroneFlightRecorder: recording to %s"), *Filename);
+	return true;
+}
+
+void UDroneFlightRecorderSubsystem::StopRecording()
+{
+	if (!IsRecording())
+	{
+		return;
+	}
+
+	if (!FrameBuffer.IsEmpty())
+	{
+		Writer->Enqueue(MoveTemp(FrameBuffer));
+	}
+	const int64 BytesQueued = Writer->GetBytesWritten();
+
+	// 소멸자가 기록 스레드를 멈추고 남은 버퍼를 쓴 뒤 파일을 닫는다
+	Writer.Reset();
+	FrameBuffer.Reset();
+
+	UE_LOG(LogTemp, Display, TEXT("DroneFlightRecorder: stopped, %d drones (%d skipped), %lld+ bytes in %s"), RecordedDrones.Num(), SkippedDrones.Num(), BytesQueued, *RecordingFilename);
+	RecordedDrones.Reset();
+	SkippedDrones.Reset();
+}
+
+void UDroneFlightRecorderSubsystem::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld() || !IsRecording() || FrameBuffer.IsEmpty())
+	{
+		return;
+	}
+
+	Writer->Enqueue(MoveTemp(FrameBuffer));
+	FrameBuffer.Reset();
+}
+
+UDroneFlightRecorderSubsystem::FRecordedDrone& UDroneFlightRecorderSubsystem::FindOrAddRecordedDrone(const UDroneMovementComponent* Drone)
+{
+	if (FRecordedDrone* Found = RecordedDrones.Find(Drone))
+	{
+		return *Found;
+	}
+
+	FRecordedDrone& Recorded = RecordedDrones.Add(Drone);
+	Recorded.Id = NextDroneId++;
+
+	FMemoryWriter Ar(FrameBuffer, false, true);
+	uint8 Type = static_cast<uint8>(ERecordType::Spawn);
+	FString ClassPath = Drone->GetOwner() ? Drone->GetOwner()->GetClass()->GetPathName() : FString();
+	uint8 GroundTraceMode = static_cast<uint8>(Drone->GroundTraceMode);
+	FDroneFlightKeyframe Keyframe = CaptureKeyframe(Drone);
+	Ar << Type;
+	Ar.SerializeIntPacked(Recorded.Id);
+	Ar << ClassPath;
+	Ar << GroundTraceMode;
+	Ar << Keyframe;
+
+	return Recorded;
+}
+
+void UDroneFlightRecorderSubsystem::RecordFrame(const UDroneMovementComponent* Drone, const FDroneInputCommand& Command, float DeltaTime, float CatchUpTime)
+{
+	FRecordedDrone& Recorded = FindOrAddRecordedDrone(Drone);
+
+	using namespace DroneFlightRecorder;
+	uint8 Flags = 0;
+	Flags |= Command.Move.IsZero() ? 0 : HasMove;
+	Flags |= Command.Look.IsZero() ? 0 : HasLook;
+	Flags |= Command.Thrust == 0.f ? 0 : HasThrust;
+	Flags |= Command.Roll == 0.f ? 0 : HasRoll;
+	Flags |= Command.bElevating ? Elevating : 0;
+	Flags |= Command.bVelocityReset ? VelocityReset : 0;
+	Flags |= CatchUpTime == 0.f ? 0 : HasCatchUp;
+
+	// 이번 프레임에 섞일 회피 조향과 드론 간 스윕 무시 상태 (재생 중에는 회피 서브시스템이 틱하지 않는다).
+	// 조향을 받지 않는 드론은 0 으로 남겨 컨트롤러 없이 재생되는 드론에도 섞이지 않게 한다
+	FVector AvoidanceVelocity = Drone->ReceivesAvoidanceSteering() ? Drone->AvoidanceVelocity : FVector::ZeroVector;
+	uint8 bSweepsIgnored = Drone->bAvoidanceSweepsIgnored ? 1 : 0;
+	Flags |= AvoidanceVelocity.IsZero() && !bSweepsIgnored ? 0 : HasAvoidance;
+
+	// 입력이 없는 프레임은 타입/ID/시간/플래그만 (값은 그대로 기록해 재생이 비트 단위로 같게 한다)
+	FMemoryWriter Ar(FrameBuffer, false, true);
+	uint8 Type = static_cast<uint8>(ERecordType::Frame);
+	Ar << Type;
+	Ar.SerializeIntPacked(Recorded.Id);
+	Ar << DeltaTime;
+	Ar << Flags;
+
+	FDroneInputCommand Values = Command;
+	if (Flags & HasMove)
+	{
+		Ar << Values.Move;
+	}
+	if (Flags & HasLook)
+	{
+		Ar << Values.Look;
+	}
+	if (Flags & HasThrust)
+	{
+		Ar << Values.Thrust;
+	}
+	if (Flags & HasRoll)
+	{
+		Ar << Values.Roll;
+	}
+	if (Flags & HasCatchUp)
+	{
+		Ar << CatchUpTime;
+	}
+	if (Flags & HasAvoidance)
+	{
+		Ar << AvoidanceVelocity;
+		Ar << bSweepsIgnored;
+	}
+}
+
+void UDroneFlightRecorderSubsystem::RecordPostFrame(const UDroneMovementComponent* Drone)
+{
+	FRecordedDrone& Recorded = FindOrAddRecordedDrone(Drone);
+	if (++Recorded.FramesSinceKeyframe >= KeyframeInterval)
+	{
+		Recorded.FramesSinceKeyframe = 0;
+		WriteKeyframe(ERecordType::Keyframe, Recorded.Id, Drone);
+	}
+}
+
+void UDroneFlightRecorderSubsystem::RecordReset(const UDroneMovementComponent* Drone)
+{
+	FRecordedDrone& Recorded = FindOrAddRecordedDrone(Drone);
+	Recorded.FramesSinceKeyframe = 0;
+	WriteKeyframe(ERecordType::Reset, Recorded.Id, Drone);
+}
+
+void UDroneFlightRecorderSubsystem::RecordDespawn(const UDroneMovementComponent* Drone)
+{
+	FRecordedDrone Recorded;
+	if (!RecordedDrones.RemoveAndCopyValue(Drone, Recorded))
+	{
+		return;
+	}
+
+	FMemoryWriter Ar(FrameBuffer, false, true);
+	uint8 Type = static_cast<uint8>(ERecordType::Despawn);
+	Ar << Type;
+	Ar.SerializeIntPacked(Recorded.Id);
+}
+
+void UDroneFlightRecorderSubsystem::RecordSkipped(const UDroneMovementComponent* Drone)
+{
+	bool bAlreadySkipped = false;
+	SkippedDrones.Add(Drone, &bAlreadySkipped);
+	UE_CLOG(!bAlreadySkipped, LogTemp, Warning, TEXT("DroneFlightRecorder: %s uses async physics and is not recorded"), *GetNameSafe(Drone->GetOwner()));
+}
+
+void UDroneFlightRecorderSubsystem::WriteKeyframe(ERecordType RecordType, uint32 Id, const UDroneMovementComponent* Drone)
+{
+	FMemoryWriter Ar(FrameBuffer, false, true);
+	uint8 Type = static_cast<uint8>(RecordType);
+	FDroneFlightKeyframe Keyframe = CaptureKeyframe(Drone);
+	Ar << Type;
+	Ar.SerializeIntPacked(Id);
+	Ar << Keyframe;
+}
+
+FDroneFlightKeyframe UDroneFlightRecorderSubsystem::CaptureKeyframe(const UDroneMovementComponent* Drone)
+{
+	FDroneFlightKeyframe Keyframe;
+	Keyframe.Location = Drone->UpdatedComponent->GetComponentLocation();
+	Keyframe.Rotation = Drone->UpdatedComponent->GetComponentRotation();
+	Keyframe.ZVelocity = Drone->CurrentZVelocity;
+	Keyframe.MovementMode = Drone->MovementMode;
+	Keyframe.bElevating = Drone->bIsElevating;
+
+	Keyframe.FixedStepAccumulator = Drone->FixedStepAccumulator;
+	Keyframe.InterpolationAlpha = Drone->InterpolationAlpha;
+	Keyframe.LastStepOffsetZ = Drone->LastStepOffsetZ;
+	Keyframe.LastStepHorizontalOffset = Drone->LastStepHorizontalOffset;
+	Keyframe.ThrustAxis = Drone->ThrustAxis;
+	Keyframe.PendingMoveInput = Drone->PendingMoveInput;
+
+	Keyframe.CachedGroundDistance = Drone->CachedGroundDistance;
+	Keyframe.bGroundProbeHit = Drone->bGroundProbeHit;
+	Keyframe.LastGroundProbeLocation = Drone->LastGroundProbeLocation;
+	Keyframe.bGroundTracePending = Drone->PendingGroundTrace.IsValid() || Drone->bReplayGroundTracePending;
+	Keyframe.PendingGroundProbeLocation = Drone->PendingGroundProbeLocation;
+	Keyframe.PendingGroundProbeLength = Drone->PendingGroundProbeLength;
+	return Keyframe;
+}
+
+void UDroneFlightRecorderSubsystem::ApplyKeyframe(UDroneMovementComponent* Drone, const FDroneFlightKeyframe& Keyframe)
+{
+	// ApplyServerCorrection 과 같은 방식: 스윕 없이 옮기고 이동 상태 이벤트는 내지 않는다
+	Drone->PendingTranslation = FVector::ZeroVector;
+	Drone->bHasPendingRotation = false;
+	Drone->UpdatedComponent->SetWorldLocationAndRotation(Keyframe.Location, Keyframe.Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+
+	Drone->bSuppressModeEvents = true;
+	Drone->SetMovementMode(Keyframe.MovementMode);
+	Drone->bSuppressModeEvents = false;
+
+	Drone->CurrentZVelocity = Keyframe.ZVelocity;
+	Drone->bIsElevating = Keyframe.bElevating;
+
+	Drone->FixedStepAccumulator = Keyframe.FixedStepAccumulator;
+	Drone->InterpolationAlpha = Keyframe.InterpolationAlpha;
+	Drone->LastStepOffsetZ = Keyframe.LastStepOffsetZ;
+	Drone->LastStepHorizontalOffset = Keyframe.LastStepHorizontalOffset;
+	Drone->ThrustAxis = Keyframe.ThrustAxis;
+	Drone->PendingMoveInput = Keyframe.PendingMoveInput;
+
+	Drone->CachedGroundDistance = Keyframe.CachedGroundDistance;
+	Drone->bGroundProbeHit = Keyframe.bGroundProbeHit;
+	Drone->LastGroundProbeLocation = Keyframe.LastGroundProbeLocation;
+
+	// 기록 시점에 날아가던 비동기 요청은 같은 위치에서 다시 요청해 다음 프레임에 소비한다
+	Drone->DiscardAsyncGroundTrace();
+	if (Keyframe.bGroundTracePending && Drone->bReplayGroundTraces)
+	{
+		Drone->RequestReplayGroundTrace(Keyframe.PendingGroundProbeLocation, Keyframe.PendingGroundProbeLocation - FVector(0.f, 0.f, Keyframe.PendingGroundProbeLength));
+	}
+	Drone->InvalidateGroundTraceSchedule();
+}
+
+bool UDroneFlightRecorderSubsystem::Replay(const FString& Filename, bool bResyncOnKeyframe, FDroneFlightReplayResult& OutResult)
+{
+	using namespace DroneFlightRecorder;
+
+	OutResult = FDroneFlightReplayResult();
+	if (IsRecording() || bReplaying)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DroneFlightRecorder: cannot replay while recording or replaying"));
+		return false;
+	}
+
+	// 로그 전체를 매핑해 복사 없이 읽는다
+	FOpenMappedResult MappedFile = FPlatformFileManager::Get().GetPlatformFile().OpenMappedEx(*Filename);
+	if (MappedFile.HasError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("DroneFlightRecorder: failed to map %s"), *Filename);
+		return false;
+	}
+	TUniquePtr<IMappedFileHandle> MappedHandle = MappedFile.StealValue();
+	TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle->GetFileSize() > 0 ? MappedHandle->MapRegion(0, MappedHandle->GetFileSize()) : nullptr);
+	if (!MappedRegion)
+	{
+		UE_LOG(LogTemp, Error, TEXT("DroneFlightRecorder: failed to map %s"), *Filename);
+		return false;
+	}
+
+	FMemoryReaderView Ar(FMemoryView(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize()));
+
+	uint32 FileMagic = 0;
+	uint16 FileVersion = 0;
+	Ar << FileMagic;
+	Ar << FileVersion;
+	if (FileMagic != Magic || FileVersion != Version)
+	{
+		UE_LOG(LogTemp, Error, TEXT("DroneFlightRecorder: %s is not a version %d flight log"), *Filename, Version);
+		return false;
+	}
+
+	DRONE_TRACE_SCOPE(UDroneFlightRecorderSubsystem::Replay);
+	TGuardValue<bool> ReplayingGuard(bReplaying, true);
+
+	UWorld* World = GetWorld();
+	TMap<uint32, FReplayDrone> Drones;
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	while (!Ar.AtEnd() && !Ar.IsError())
+	{
+		uint8 Type = 0;
+		uint32 Id = 0;
+		Ar << Type;
+		Ar.SerializeIntPacked(Id);
+
+		switch (static_cast<ERecordType>(Type))
+		{
+		case ERecordType::Spawn:
+		{
+			FString ClassPath;
+			uint8 GroundTraceMode = 0;
+			FDroneFlightKeyframe Keyframe;
+			Ar << ClassPath;
+			Ar << GroundTraceMode;
+			Ar << Keyframe;
+
+			UClass* PawnClass = FSoftClassPath(ClassPath).TryLoadClass<APawn>();
+			APawn* Pawn = World->SpawnActor<APawn>(PawnClass ? PawnClass : ADronePawn::StaticClass(), Keyframe.Location, Keyframe.Rotation, SpawnParameters);
+			UDroneMovementComponent* Movement = Pawn ? Pawn->FindComponentByClass<UDroneMovementComponent>() : nullptr;
+			if (!Movement)
+			{
+				UE_LOG(LogTemp, Error, TEXT("DroneFlightRecorder: failed to spawn %s for drone %u"), *ClassPath, Id);
+				break;
+			}
+
+			// Tick 없이 기록된 프레임으로만 진행. 월드 시간이 흐르지 않으므로 지면 감지는 매 프레임 하고,
+			// 비동기 감지 드론은 한 프레임 늦은 결과를 쓰는 것까지 기록 때와 같게 한다
+			Movement->SetComponentTickEnabled(false);
+			Movement->SetSignificanceSettings(0.f, 0.f);
+			Movement->GroundTraceMode = static_cast<EDroneGroundTraceMode>(GroundTraceMode);
+			Movement->bReplayGroundTraces = true;
+			ApplyKeyframe(Movement, Keyframe);
+
+			Drones.Add(Id, { Pawn, Movement, 0.0 });
+			++OutResult.Drones;
+			break;
+		}
+
+		case ERecordType::Frame:
+		{
+			float DeltaTime = 0.f;
+			uint8 Flags = 0;
+			Ar << DeltaTime;
+			Ar << Flags;
+
+			FDroneInputCommand Command;
+			float CatchUpTime = 0.f;
+			FVector AvoidanceVelocity = FVector::ZeroVector;
+			uint8 bSweepsIgnored = 0;
+			if (Flags & HasMove)
+			{
+				Ar << Command.Move;
+			}
+			if (Flags & HasLook)
+			{
+				Ar << Command.Look;
+			}
+			if (Flags & HasThrust)
+			{
+				Ar << Command.Thrust;
+			}
+			if (Flags & HasRoll)
+			{
+				Ar << Command.Roll;
+			}
+			if (Flags & HasCatchUp)
+			{
+				Ar << CatchUpTime;
+			}
+			if (Flags & HasAvoidance)
+			{
+				Ar << AvoidanceVelocity;
+				Ar << bSweepsIgnored;
+			}
+			Command.bElevating = (Flags & Elevating) != 0;
+			Command.bVelocityReset = (Flags & VelocityReset) != 0;
+
+			if (FReplayDrone* Drone = Drones.Find(Id))
+			{
+				UDroneMovementComponent* Movement = Drone->Movement;
+				Movement->InputCommand = Command;
+				Movement->SimCatchUpTime = CatchUpTime;
+				Movement->AvoidanceVelocity = AvoidanceVelocity;
+				UDroneAvoidanceSubsystem::SetDroneSweepsIgnored(Movement, bSweepsIgnored != 0);
+				Movement->InvalidateGroundTraceSchedule();
+				Movement->SimulateFrame(DeltaTime);
+
+				Drone->SimSeconds += DeltaTime;
+				OutResult.RecordedSeconds = FMath::Max(OutResult.RecordedSeconds, Drone->SimSeconds);
+				++OutResult.Frames;
+			}
+			break;
+		}
+
+		case ERecordType::Keyframe:
+		case ERecordType::Reset:
+		{
+			FDroneFlightKeyframe Keyframe;
+			Ar << Keyframe;
+
+			FReplayDrone* Drone = Drones.Find(Id);
+			if (!Drone)
+			{
+				break;
+			}
+
+			// 보정(Reset)은 비교하지 않고 기록된 상태로 맞춘다
+			if (static_cast<ERecordType>(Type) == ERecordType::Keyframe)
+			{
+				const FDroneFlightKeyframe Replayed = CaptureKeyframe(Drone->Movement);
+				const double LocationError = FVector::Dist(Replayed.Location, Keyframe.Location);
+				const float ZVelocityError = FMath::Abs(Replayed.ZVelocity - Keyframe.ZVelocity);
+				const bool bModeMismatch = Replayed.MovementMode != Keyframe.MovementMode;
+
+				++OutResult.KeyframesChecked;
+				OutResult.MaxLocationError = FMath::Max(OutResult.MaxLocationError, LocationError);
+				OutResult.MaxZVelocityError = FMath::Max(OutResult.MaxZVelocityError, ZVelocityError);
+				OutResult.ModeMismatches += bModeMismatch ? 1 : 0;
+
+				if (bModeMismatch || LocationError > ReplayLocationTolerance || ZVelocityError > ReplayZVelocityTolerance)
+				{
+					UE_CLOG(OutResult.DivergentKeyframes == 0, LogTemp, Warning, TEXT("DroneFlightRecorder: drone %u first diverges at %.3f s, replayed %s vz %.2f mode %d, recorded %s vz %.2f mode %d"),
+						Id, Drone->SimSeconds,
+						*Replayed.Location.ToCompactString(), Replayed.ZVelocity, static_cast<int32>(Replayed.MovementMode),
+						*Keyframe.Location.ToCompactString(), Keyframe.ZVelocity, static_cast<int32>(Keyframe.MovementMode));
+					++OutResult.DivergentKeyframes;
+				}
+			}
+
+			if (bResyncOnKeyframe || static_cast<ERecordType>(Type) == ERecordType::Reset)
+			{
+				ApplyKeyframe(Drone->Movement, Keyframe);
+			}
+			break;
+		}
+
+		case ERecordType::Despawn:
+		{
+			FReplayDrone Drone;
+			if (Drones.RemoveAndCopyValue(Id, Drone) && IsValid(Drone.Pawn))
+			{
+				Drone.Pawn->Destroy();
+			}
+			break;
+		}
+
+		default:
+			UE_LOG(LogTemp, Error, TEXT("DroneFlightRecorder: unknown record type %d in %s"), Type, *Filename);
+			Ar.SetError();
+			break;
+		}
+	}
+	OutResult.WallSeconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	for (const TPair<uint32, FReplayDrone>& Pair : Drones)
+	{
+		if (IsValid(Pair.Value.Pawn))
+		{
+			Pair.Value.Pawn->Destroy();
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("DroneFlightRecorder: replayed %s: %d drones, %lld frames, %.2f s recorded in %.3f s (%.1fx), %lld/%lld keyframes diverged, max location error %.3f, max vz error %.3f, %d mode mismatches%s"),
+		*Filename, OutResult.Drones, OutResult.Frames, OutResult.RecordedSeconds, OutResult.WallSeconds,
+		OutResult.RecordedSeconds / FMath::Max(OutResult.WallSeconds, UE_DOUBLE_SMALL_NUMBER),
+		OutResult.DivergentKeyframes, OutResult.KeyframesChecked, OutResult.MaxLocationError, OutResult.MaxZVelocityError, OutResult.ModeMismatches,
+		Ar.IsError() ? TEXT(" (log truncated or corrupt)") : TEXT(""));
+
+	WriteReplayCsv(Filename, OutResult);
+	return !Ar.IsError();
+}
+
+void UDroneFlightRecorderSubsystem::WriteReplayCsv(const FString& Filename, const FDroneFlightReplayResult& Result) const
+{
+	const FString CsvFilename = FPaths::ProfilingDir() / TEXT("DroneReplay") / TEXT("DroneReplay.csv");
+	if (!IFileManager::Get().FileExists(*CsvFilename))
+	{
+		FFileHelper::SaveStringToFile(TEXT("Timestamp,Build,Log,Drones,Frames,RecordedS,WallS,Speedup,FramesPerS,KeyframesChecked,DivergentKeyframes,MaxLocationError,MaxZVelocityError,ModeMismatches\n"), *CsvFilename);
+	}
+
+	const FString Row = FString::Printf(TEXT("%s,%s,%s,%d,%lld,%.3f,%.3f,%.2f,%.0f,%lld,%lld,%.4f,%.4f,%d\n"),
+		*FDateTime::UtcNow().ToIso8601(),
+		FApp::GetBuildVersion(),
+		*FPaths::GetCleanFilename(Filename),
+		Result.Drones,
+		Result.Frames,
+		Result.RecordedSeconds,
+		Result.WallSeconds,
+		Result.RecordedSeconds / FMath::Max(Result.WallSeconds, UE_DOUBLE_SMALL_NUMBER),
+		Result.Frames / FMath::Max(Result.WallSeconds, UE_DOUBLE_SMALL_NUMBER),
+		Result.KeyframesChecked,
+		Result.DivergentKeyframes,
+		Result.MaxLocationError,
+		Result.MaxZVelocityError,
+		Result.ModeMismatches);
+	FFileHelper::SaveStringToFile(Row, *CsvFilename, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+}
@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/DroneHeightFieldSubsystem.h"
+
+#include "Data/DroneHeightField.h"
+
+bool UDroneHeightFieldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDroneHeightFieldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const FString MapPackageName = UWorld::RemovePIEPrefix(GetWorld()->GetOutermost()->GetName());
+	const FString Filename = FDroneHeightField::GetHeightFieldPath(MapPackageName);
+
+	TSharedPtr<FDroneHeightField> LoadedField = MakeShared<FDroneHeightField>();
+	if (LoadedField->Load(Filename))
+	{
+		HeightField = LoadedField;
+		UE_LOG(LogTemp, Log, TEXT("DroneHeightFieldSubsystem: Loaded %s"), *Filename);
+	}
+}
+
+void UDroneHeightFieldSubsystem::Deinitialize()
+{
+	HeightField.Reset();
+
+	Super::Deinitialize();
+}
@@ -0,0 +1,180 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/DroneInputLatencySubsystem.h"
+
+#include "DroneStats.h"
+#include "Components/Movement/DroneMovementComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+namespace DroneInputLatency
+{
+	float Percentile(TArray<float> Values, float Fraction)
+	{
+		if (Values.IsEmpty())
+		{
+			return 0.f;
+		}
+		Values.Sort();
+		const int32 Index = FMath::Clamp(FMath::CeilToInt32(Fraction * Values.Num()) - 1, 0, Values.Num() - 1);
+		return Values[Index];
+	}
+
+	UDroneInputLatencySubsystem* FindSubsystem(UWorld* World)
+	{
+		UDroneInputLatencySubsystem* LatencySubsystem = World ? World->GetSubsystem<UDroneInputLatencySubsystem>() : nullptr;
+		if (!LatencySubsystem)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("DroneInputLatency: no game world with latency tracking"));
+		}
+		return LatencySubsystem;
+	}
+
+	void ReportCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		if (const UDroneInputLatencySubsystem* LatencySubsystem = FindSubsystem(World))
+		{
+			LatencySubsystem->LogReport();
+		}
+	}
+
+	void ResetCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		if (UDroneInputLatencySubsystem* LatencySubsystem = FindSubsystem(World))
+		{
+			LatencySubsystem->ResetWindows();
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs DroneLatencyReportCommand(
+	TEXT("drone.Latency.Report"),
+	TEXT("Log p50/p95/p99/max input-to-motion and input-to-camera latency over the sliding window, and the share of samples over the latency budget."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DroneInputLatency::ReportCommand));
+
+static FAutoConsoleCommandWithWorldAndArgs DroneLatencyResetCommand(
+	TEXT("drone.Latency.Reset"),
+	TEXT("Clear the input latency windows."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DroneInputLatency::ResetCommand));
+
+void UDroneInputLatencySubsystem::FLatencyWindow::Add(float LatencyMs, int32 Capacity)
+{
+	if (SamplesMs.Num() < Capacity)
+	{
+		SamplesMs.Add(LatencyMs);
+	}
+	else
+	{
+		SamplesMs[NextIndex] = LatencyMs;
+	}
+	NextIndex = (NextIndex + 1) % Capacity;
+}
+
+void UDroneInputLatencySubsystem::FLatencyWindow::Reset()
+{
+	SamplesMs.Reset();
+	NextIndex = 0;
+}
+
+bool UDroneInputLatencySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Shipping 빌드에서는 측정하지 않는다
+	return DRONE_STATS && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool UDroneInputLatencySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDroneInputLatencySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	WindowSize = FMath::Max(1, WindowSize);
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ThisClass::HandleWorldPostActorTick);
+}
+
+void UDroneInputLatencySubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	PendingCameraSampleTimes.Empty();
+
+	Super::Deinitialize();
+}
+
+void UDroneInputLatencySubsystem::RecordMotion(const UDroneMovementComponent* Drone, double SampleTime)
+{
+	const double LatencySeconds = FPlatformTime::Seconds() - SampleTime;
+	if (LatencySeconds < 0.0 || LatencySeconds > MaxTrackedLatency)
+	{
+		return;
+	}
+
+	const float LatencyMs = static_cast<float>(LatencySeconds * 1000.0);
+	MotionWindow.Add(LatencyMs, WindowSize);
+	CSV_CUSTOM_STAT(Drone, InputToMotionMs, LatencyMs, ECsvCustomStatOp::Max);
+
+	// 로컬 플레이어가 보고 있는 드론만 카메라 단계까지 추적
+	const APawn* Pawn = Drone ? Drone->GetPawnOwner() : nullptr;
+	const APlayerController* PlayerController = Pawn ? Cast<APlayerController>(Pawn->GetController()) : nullptr;
+	if (PlayerController && PlayerController->IsLocalController() && PlayerController->GetViewTarget() == Pawn)
+	{
+		PendingCameraSampleTimes.Add(SampleTime);
+	}
+}
+
+void UDroneInputLatencySubsystem::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	// 모든 Tick 과 플레이어 카메라 매니저 갱신이 끝난 시점
+	if (World != GetWorld() || PendingCameraSampleTimes.IsEmpty())
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	for (const double SampleTime : PendingCameraSampleTimes)
+	{
+		const float LatencyMs = static_cast<float>((Now - SampleTime) * 1000.0);
+		CameraWindow.Add(LatencyMs, WindowSize);
+		CSV_CUSTOM_STAT(Drone, InputToCameraMs, LatencyMs, ECsvCustomStatOp::Max);
+	}
+	PendingCameraSampleTimes.Reset();
+}
+
+void UDroneInputLatencySubsystem::ResetWindows()
+{
+	MotionWindow.Reset();
+	CameraWindow.Reset();
+	PendingCameraSampleTimes.Reset();
+}
+
+void UDroneInputLatencySubsystem::LogReport() const
+{
+	UE_LOG(LogTemp, Display, TEXT("Drone input latency (window %d, budget %.1f ms)"), WindowSize, LatencyBudgetMs);
+	UE_LOG(LogTemp, Display, TEXT("%-8s %8s %8s %8s %8s %8s %10s"), TEXT("Stage"), TEXT("Samples"), TEXT("P50"), TEXT("P95"), TEXT("P99"), TEXT("Max"), TEXT("OverBudget"));
+	LogWindow(TEXT("Motion"), MotionWindow);
+	LogWindow(TEXT("Camera"), CameraWindow);
+}
+
+void UDroneInputLatencySubsystem::LogWindow(const TCHAR* StageName, const FLatencyWindow& Window) const
+{
+	int32 OverBudget = 0;
+	float MaxMs = 0.f;
+	for (const float LatencyMs : Window.SamplesMs)
+	{
+		MaxMs = FMath::Max(MaxMs, LatencyMs);
+		OverBudget += LatencyMs > LatencyBudgetMs ? 1 : 0;
+	}
+
+	const float OverBudgetPercent = Window.SamplesMs.IsEmpty() ? 0.f : 100.f * OverBudget / Window.SamplesMs.Num();
+
+	UE_LOG(LogTemp, Display, TEXT("%-8s %8d %8.2f %8.2f %8.2f %8.2f %9.1f%%"),
+		StageName, Window.SamplesMs.Num(),
+		DroneInputLatency::Percentile(Window.SamplesMs, 0.5f),
+		DroneInputLatency::Percentile(Window.SamplesMs, 0.95f),
+		DroneInputLatency::Percentile(Window.SamplesMs, 0.99f),
+		MaxMs, OverBudgetPercent);
+}
@@ -0,0 +1,375 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/DroneMovementSubsystem.h"
+
+#include "DroneStats.h"
+#include "Async/ParallelFor.h"
+#include "PBDRigidsSolver.h"
+#include "Components/Movement/DroneMovementComponent.h"
+#include "Physics/DroneAsyncPhysicsCallback.h"
+#include "Physics/DroneKinematics.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+#include "Subsystems/DroneFleetPerfSubsystem.h"
+#include "Subsystems/DroneHeightFieldSubsystem.h"
+
+namespace DroneMovementBatch
+{
+	// 워커 하나가 처리하는 드론 수 (4의 배수로 유지해 벡터 루프가 청크 경계를 넘지 않게 한다)
+	constexpr int32 ChunkSize = 512;
+}
+
+bool UDroneMovementSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDroneMovementSubsystem::Deinitialize()
+{
+	// 서브시스템보다 오래 남는 드론 (월드 정리 중, PIE 서브시스템 재초기화) 은 개별 Tick 으로 되돌린다
+	for (UDroneMovementComponent* Drone : Drones)
+	{
+		if (Drone)
+		{
+			Drone->BatchIndex = INDEX_NONE;
+			RestoreComponentTick(Drone);
+		}
+	}
+	Drones.Empty();
+
+	FrameDeltaTime.Empty();
+	ZVelocity.Empty();
+	FlyingMask.Empty();
+	PendingThrust.Empty();
+	StepDeltaTime.Empty();
+	NumSteps.Empty();
+	DeltaZ.Empty();
+	LastStepOffsetZ.Empty();
+
+	GravityZ.Empty();
+	MaxFallingSpeed.Empty();
+	MaxAscendingSpeed.Empty();
+	ThrustAccelZ.Empty();
+
+	for (const TPair<uint32, UDroneMovementComponent*>& Pair : AsyncPhysicsDrones)
+	{
+		if (Pair.Value)
+		{
+			Pair.Value->AsyncPhysicsId = 0;
+			RestoreComponentTick(Pair.Value);
+		}
+	}
+	AsyncPhysicsDrones.Empty();
+
+	if (AsyncPhysicsCallback)
+	{
+		if (FPhysScene* PhysScene = GetWorld()->GetPhysicsScene())
+		{
+			PhysScene->GetSolver()->UnregisterAndFreeSimCallbackObject_External(AsyncPhysicsCallback);
+		}
+		AsyncPhysicsCallback = nullptr;
+	}
+
+	Super::Deinitialize();
+}
+
+void UDroneMovementSubsystem::RestoreComponentTick(UDroneMovementComponent* Drone)
+{
+	// 잠들었거나 풀에 반납된 드론은 깨어나거나 꺼내질 때 Tick 이 켜진다
+	if (IsValid(Drone) && !Drone->IsSleeping() && !Drone->IsPooled())
+	{
+		Drone->SetComponentTickEnabled(true);
+	}
+}
+
+TStatId UDroneMovementSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDroneMovementSubsystem, STATGROUP_Tickables);
+}
+
+void UDroneMovementSubsystem::RegisterDrone(UDroneMovementComponent* Drone)
+{
+	if (!Drone || Drone->BatchIndex != INDEX_NONE)
+	{
+		return;
+	}
+
+	Drone->BatchIndex = Drones.Add(Drone);
+
+	FrameDeltaTime.Add(0.f);
+	ZVelocity.Add(Drone->CurrentZVelocity);
+	FlyingMask.Add(0.f);
+	PendingThrust.Add(0.f);
+	StepDeltaTime.Add(0.f);
+	NumSteps.Add(0.f);
+	DeltaZ.Add(0.f);
+	LastStepOffsetZ.Add(0.f);
+
+	GravityZ.Add(Drone->GravityZ);
+	MaxFallingSpeed.Add(Drone->MaxFallingSpeed);
+	MaxAscendingSpeed.Add(Drone->MaxAscendingSpeed);
+	ThrustAccelZ.Add(Drone->ThrustAccelZ);
+}
+
+void UDroneMovementSubsystem::UnregisterDrone(UDroneMovementComponent* Drone)
+{
+	if (!Drone || !Drones.IsValidIndex(Drone->BatchIndex) || Drones[Drone->BatchIndex] != Drone)
+	{
+		return;
+	}
+
+	RemoveSlot(Drone->BatchIndex);
+	Drone->BatchIndex = INDEX_NONE;
+}
+
+void UDroneMovementSubsystem::RemoveSlot(int32 Index)
+{
+	Drones.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	FrameDeltaTime.RemoveAtSwap(Index, EAllowShrinking::No);
+	ZVelocity.RemoveAtSwap(Index, EAllowShrinking::No);
+	FlyingMask.RemoveAtSwap(Index, EAllowShrinking::No);
+	PendingThrust.RemoveAtSwap(Index, EAllowShrinking::No);
+	StepDeltaTime.RemoveAtSwap(Index, EAllowShrinking::No);
+	NumSteps.RemoveAtSwap(Index, EAllowShrinking::No);
+	DeltaZ.RemoveAtSwap(Index, EAllowShrinking::No);
+	LastStepOffsetZ.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	GravityZ.RemoveAtSwap(Index, EAllowShrinking::No);
+	MaxFallingSpeed.RemoveAtSwap(Index, EAllowShrinking::No);
+	MaxAscendingSpeed.RemoveAtSwap(Index, EAllowShrinking::No);
+	ThrustAccelZ.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	// 마지막 슬롯이 빈 자리로 옮겨졌으면 인덱스 갱신
+	if (Drones.IsValidIndex(Index) && Drones[Index])
+	{
+		Drones[Index]->BatchIndex = Index;
+	}
+}
+
+bool UDroneMovementSubsystem::RegisterAsyncPhysicsDrone(UDroneMovementComponent* Drone)
+{
+	if (!Drone || Drone->IsAsyncPhysics())
+	{
+		return Drone && Drone->IsAsyncPhysics();
+	}
+
+	// 프로젝트 전체의 Chaos 시뮬레이션을 비동기로 바꾸는 설정이므로 자동으로 켜지 않는다 (꺼져 있으면 배치 모드로 대체)
+	if (!UPhysicsSettings::Get()->bTickPhysicsAsync)
+	{
+		static bool bWarnedAsyncPhysicsDisabled = false;
+		if (!bWarnedAsyncPhysicsDisabled)
+		{
+			bWarnedAsyncPhysicsDisabled = true;
+			UE_LOG(LogTemp, Warning, TEXT("DroneMovementSubsystem: AsyncPhysics tick mode needs Project Settings > Physics > Tick Physics Async. Falling back to Batched."));
+		}
+		return false;
+	}
+
+	if (!AsyncPhysicsCallback)
+	{
+		FPhysScene* PhysScene = GetWorld()->GetPhysicsScene();
+		if (!PhysScene || !PhysScene->GetSolver())
+		{
+			return false;
+		}
+		AsyncPhysicsCallback = PhysScene->GetSolver()->CreateAndRegisterSimCallbackObject_External<FDroneAsyncPhysicsCallback>();
+	}
+
+	Drone->AsyncPhysicsId = NextAsyncPhysicsDroneId++;
+	Drone->AsyncPhysicsMode = Drone->MovementMode;
+	AsyncPhysicsDrones.Add(Drone->AsyncPhysicsId, Drone);
+	return true;
+}
+
+void UDroneMovementSubsystem::UnregisterAsyncPhysicsDrone(UDroneMovementComponent* Drone)
+{
+	if (!Drone || !Drone->IsAsyncPhysics())
+	{
+		return;
+	}
+
+	AsyncPhysicsDrones.Remove(Drone->AsyncPhysicsId);
+	RemovedAsyncPhysicsDroneIds.Add(Drone->AsyncPhysicsId);
+	Drone->AsyncPhysicsId = 0;
+}
+
+void UDroneMovementSubsystem::TickAsyncPhysicsDrones(float DeltaTime)
+{
+	DRONE_TRACE_SCOPE(UDroneMovementSubsystem::TickAsyncPhysicsDrones);
+
+	// 1. 물리 스텝 결과 수집 (여러 스텝이면 이동량은 합산, 속도/상태는 최신값)
+	while (Chaos::TSimCallbackOutputHandle<FDroneAsyncPhysicsOutput> Output = AsyncPhysicsCallback->PopOutputData_External())
+	{
+		for (const FDroneAsyncPhysicsDroneOutput& DroneOutput : Output->Drones)
+		{
+			if (UDroneMovementComponent* const* Drone = AsyncPhysicsDrones.Find(DroneOutput.DroneId))
+			{
+				(*Drone)->CurrentZVelocity = DroneOutput.ZVelocity;
+				(*Drone)->AsyncPhysicsOffsetZ += DroneOutput.OffsetZ;
+				(*Drone)->AsyncPhysicsMode = DroneOutput.MovementMode;
+			}
+		}
+	}
+
+	// 2. 게임 스레드 반영, 입력 소비 및 지면 프로브 (프로브는 거리 캐시만 갱신)
+	TArray<UDroneMovementComponent*> ActiveDrones;
+	AsyncPhysicsDrones.GenerateValueArray(ActiveDrones);
+
+	for (UDroneMovementComponent* Drone : ActiveDrones)
+	{
+		if (Drone && Drone->IsAsyncPhysics() && Drone->CanSimulate() && !Drone->IsSleeping())
+		{
+			Drone->ApplyAsyncPhysicsResults();
+			Drone->ConsumeInputCommand(DeltaTime);
+			Drone->PerformGroundTrace();
+			Drone->CommitPendingMove();
+		}
+	}
+
+	// 3. 다음 물리 스텝들에 쓸 입력 전송 (잠든 드론은 빠지므로 물리 스레드도 스텝하지 않는다)
+	FDroneAsyncPhysicsInput* Input = AsyncPhysicsCallback->GetProducerInputData_External();
+	Input->Drones.Reset(AsyncPhysicsDrones.Num());
+	Input->RemovedDroneIds.Append(RemovedAsyncPhysicsDroneIds);
+	RemovedAsyncPhysicsDroneIds.Reset();
+
+	if (const UDroneHeightFieldSubsystem* HeightFieldSubsystem = UWorld::GetSubsystem<UDroneHeightFieldSubsystem>(GetWorld()))
+	{
+		Input->HeightField = HeightFieldSubsystem->GetHeightField();
+	}
+
+	for (const TPair<uint32, UDroneMovementComponent*>& Pair : AsyncPhysicsDrones)
+	{
+		UDroneMovementComponent* Drone = Pair.Value;
+		if (Drone && Drone->CanSimulate() && !Drone->IsSleeping())
+		{
+			Drone->BuildAsyncPhysicsInput(Input->Drones.AddDefaulted_GetRef());
+			Drone->FinishSimFrame(0.f);
+		}
+	}
+}
+
+void UDroneMovementSubsystem::Tick(float DeltaTime)
+{
+	DRONE_SCOPE_CYCLE_COUNTER(STAT_DroneMovementBatch, MovementBatch);
+	DRONE_FLEET_PERF_SCOPE(MovementCycles);
+
+	if (AsyncPhysicsCallback)
+	{
+		TickAsyncPhysicsDrones(DeltaTime);
+	}
+
+	if (Drones.IsEmpty())
+	{
+		return;
+	}
+
+	// 1. 입력 소비, 지면 감지 및 상태 전환 (델리게이트 호출이 있으므로 게임 스레드에서 순차 처리)
+	//    중요도 LOD 로 이번 프레임 갱신 차례가 아닌 드론은 건너뛰고, 차례가 오면 밀린 시간을 한 번에 적분한다
+	//    비동기 모드 드론은 여기서 전 프레임 결과를 소비하고 이번 프레임 요청을 한 묶음으로 보낸다
+	{
+		DRONE_TRACE_SCOPE(UDroneMovementSubsystem::GroundPass);
+
+		for (int32 Index = 0; Index < Drones.Num(); ++Index)
+		{
+			FrameDeltaTime[Index] = 0.f;
+
+			UDroneMovementComponent* Drone = Drones[Index];
+			if (Drone && Drone->CanSimulate() && !Drone->IsSleeping() && Drone->IsSimUpdateDue())
+			{
+				FrameDeltaTime[Index] = Drone->ConsumeSimElapsedTime(DeltaTime);
+				Drone->ConsumeInputCommand(FrameDeltaTime[Index]);
+				Drone->PerformGroundTrace();
+			}
+		}
+	}
+
+	// 2. 상태 수집 → 3. 병렬 적분 → 4. 트랜스폼 반영
+	const int32 MaxSteps = GatherState();
+	IntegrateBatch(MaxSteps);
+	CommitTransforms();
+}
+
+int32 UDroneMovementSubsystem::GatherState()
+{
+	DRONE_TRACE_SCOPE(UDroneMovementSubsystem::GatherState);
+
+	int32 MaxSteps = 0;
+
+	for (int32 Index = 0; Index < Drones.Num(); ++Index)
+	{
+		UDroneMovementComponent* Drone = Drones[Index];
+		const bool bSimulate = Drone && FrameDeltaTime[Index] > 0.f;
+
+		// 드론별 시뮬레이션 시계 진행 (고정 스텝 드론은 0~MaxSubsteps 스텝)
+		float StepDt = 0.f;
+		const int32 Steps = bSimulate ? Drone->AdvanceSimClock(FrameDeltaTime[Index], StepDt) : 0;
+		MaxSteps = FMath::Max(MaxSteps, Steps);
+
+		// 파라미터는 매 프레임 다시 읽는다 (런타임에 바뀐 값을 개별 Tick 모드와 같이 바로 반영)
+		if (Drone)
+		{
+			const FDroneKinematicsParams Params = Drone->GetKinematicsParams();
+			GravityZ[Index] = Params.GravityZ;
+			MaxFallingSpeed[Index] = Params.MaxFallingSpeed;
+			MaxAscendingSpeed[Index] = Params.MaxAscendingSpeed;
+			ThrustAccelZ[Index] = Params.ThrustAccelZ;
+		}
+
+		ZVelocity[Index] = Drone ? Drone->CurrentZVelocity : 0.f;
+		LastStepOffsetZ[Index] = Drone ? Drone->LastStepOffsetZ : 0.f;
+		FlyingMask[Index] = (bSimulate && Drone->ShouldApplyPhysics()) ? 1.f : 0.f;
+		PendingThrust[Index] = bSimulate ? Drone->GetStepThrust(StepDt) : 0.f;
+		StepDeltaTime[Index] = StepDt;
+		NumSteps[Index] = static_cast<float>(Steps);
+	}
+
+	return MaxSteps;
+}
+
+void UDroneMovementSubsystem::IntegrateBatch(int32 MaxSteps)
+{
+	DRONE_TRACE_SCOPE(UDroneMovementSubsystem::IntegrateBatch);
+
+	const FDroneKinematicsBatchView View{
+		ZVelocity.GetData(), DeltaZ.GetData(), LastStepOffsetZ.GetData(),
+		FlyingMask.GetData(), PendingThrust.GetData(), StepDeltaTime.GetData(), NumSteps.GetData(),
+		GravityZ.GetData(), MaxFallingSpeed.GetData(), MaxAscendingSpeed.GetData(), ThrustAccelZ.GetData()
+	};
+
+	const int32 Num = Drones.Num();
+	const int32 NumChunks = FMath::DivideAndRoundUp(Num, DroneMovementBatch::ChunkSize);
+
+	ParallelFor(NumChunks, [&View, Num, MaxSteps](int32 ChunkIndex)
+	{
+		DRONE_TRACE_SCOPE(DroneKinematics::IntegrateBatch);
+
+		const int32 Begin = ChunkIndex * DroneMovementBatch::ChunkSize;
+		const int32 End = FMath::Min(Begin + DroneMovementBatch::ChunkSize, Num);
+		DroneKinematics::IntegrateBatch(View, Begin, End, MaxSteps);
+	}, NumChunks > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void UDroneMovementSubsystem::CommitTransforms()
+{
+	DRONE_TRACE_SCOPE(UDroneMovementSubsystem::CommitTransforms);
+
+	for (int32 Index = 0; Index < Drones.Num(); ++Index)
+	{
+		UDroneMovementComponent* Drone = Drones[Index];
+		if (!Drone || FrameDeltaTime[Index] <= 0.f)
+		{
+			continue;
+		}
+
+		Drone->CurrentZVelocity = ZVelocity[Index];
+		Drone->LastStepOffsetZ = LastStepOffsetZ[Index];
+
+		if (DeltaZ[Index] != 0.f)
+		{
+			Drone->QueueVerticalOffset(DeltaZ[Index]);
+		}
+
+		Drone->FinishSimFrame(NumSteps[Index] * StepDeltaTime[Index]);
+	}
+}
@@ -0,0 +1,230 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/DronePoolSubsystem.h"
+
+#include "DroneStats.h"
+#include "Components/Movement/DroneMovementComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Pawns/DronePawn.h"
+
+namespace DronePool
+{
+	UDronePoolSubsystem* GetPool(UWorld* World)
+	{
+		UDronePoolSubsystem* Pool = World ? World->GetSubsystem<UDronePoolSubsystem>() : nullptr;
+		UE_CLOG(!Pool, LogTemp, Warning, TEXT("DronePool: no game world"));
+		return Pool;
+	}
+
+	void StatsCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		if (UDronePoolSubsystem* Pool = GetPool(World))
+		{
+			Pool->LogStats();
+		}
+	}
+
+	void PrewarmCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		if (UDronePoolSubsystem* Pool = GetPool(World))
+		{
+			Pool->Prewarm(nullptr, Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 64);
+			Pool->LogStats();
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs DronePoolStatsCommand(
+	TEXT("drone.Pool.Stats"),
+	TEXT("Log drone pool hit rate, measured acquire cost for pool hits and spawning misses, and the spawn time saved."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DronePool::StatsCommand));
+
+static FAutoConsoleCommandWithWorldAndArgs DronePoolPrewarmCommand(
+	TEXT("drone.Pool.Prewarm"),
+	TEXT("Spawn idle drones of the default class into the pool. Optional argument: count (default 64)."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DronePool::PrewarmCommand));
+
+bool UDronePoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDronePoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 기본 클래스는 미리 채울 때만 여기서 로드된다 (클라이언트는 서버가 복제한 드론만 쓴다)
+	if (InWorld.GetNetMode() != NM_Client && PrewarmCount > 0)
+	{
+		Prewarm(nullptr, PrewarmCount);
+	}
+}
+
+void UDronePoolSubsystem::Deinitialize()
+{
+	if (Acquires > 0)
+	{
+		LogStats();
+	}
+
+	// 대기 중인 드론은 월드와 함께 정리된다
+	Buckets.Empty();
+
+	Super::Deinitialize();
+}
+
+UClass* UDronePoolSubsystem::ResolveClass(UClass* PawnClass)
+{
+	if (PawnClass && PawnClass->IsChildOf<ADronePawn>())
+	{
+		return PawnClass;
+	}
+
+	// 클라이언트는 풀을 쓰지 않는다 (드론은 서버가 스폰해 복제한다)
+	if (GetWorld()->GetNetMode() == NM_Client)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DronePool: drones can only be pooled on the server"));
+		return nullptr;
+	}
+
+	// 기본 클래스는 처음 꺼내거나 채울 때 로드한다 (풀을 쓰지 않는 월드는 로드하지 않는다)
+	if (!DefaultClass)
+	{
+		DefaultClass = DroneClass.IsNull() ? nullptr : DroneClass.LoadSynchronous();
+		if (!DefaultClass)
+		{
+			DefaultClass = ADronePawn::StaticClass();
+		}
+	}
+	return DefaultClass;
+}
+
+ADronePawn* UDronePoolSubsystem::SpawnDrone(UClass* PawnClass, const FVector& Location, const FRotator& Rotation)
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	return GetWorld()->SpawnActor<ADronePawn>(PawnClass, Location, Rotation, SpawnParameters);
+}
+
+void UDronePoolSubsystem::Prewarm(UClass* PawnClass, int32 Count)
+{
+	UClass* Class = ResolveClass(PawnClass);
+	if (!Class)
+	{
+		return;
+	}
+
+	DRONE_TRACE_SCOPE(UDronePoolSubsystem::Prewarm);
+
+	FDronePoolBucket& Bucket = Buckets.FindOrAdd(Class);
+	const int32 NumToSpawn = FMath::Min(Count, MaxPooledPerClass - Bucket.Free.Num());
+	if (NumToSpawn <= 0)
+	{
+		return;
+	}
+
+	Bucket.Free.Reserve(Bucket.Free.Num() + NumToSpawn);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	for (int32 Index = 0; Index < NumToSpawn; ++Index)
+	{
+		if (ADronePawn* Drone = SpawnDrone(Class, PoolLocation, FRotator::ZeroRotator))
+		{
+			Drone->ReleaseToPool();
+			Bucket.Free.Add(Drone);
+			++PrewarmSpawns;
+		}
+	}
+	PrewarmSeconds += FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+}
+
+int32 UDronePoolSubsystem::GetNumPooled(UClass* PawnClass) const
+{
+	// 기본 클래스가 아직 로드되지 않았으면 그 버킷도 없다
+	UClass* Class = PawnClass && PawnClass->IsChildOf<ADronePawn>() ? PawnClass : DefaultClass;
+	const FDronePoolBucket* Bucket = Class ? Buckets.Find(Class) : nullptr;
+	return Bucket ? Bucket->Free.Num() : 0;
+}
+
+ADronePawn* UDronePoolSubsystem::AcquireDrone(UClass* PawnClass, const FVector& Location, const FRotator& Rotation)
+{
+	UClass* Class = ResolveClass(PawnClass);
+	if (!Class)
+	{
+		return nullptr;
+	}
+
+	++Acquires;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// 대기 중인 드론 재사용 (풀 밖에서 파괴된 항목은 건너뛴다)
+	if (FDronePoolBucket* Bucket = Buckets.Find(Class))
+	{
+		while (!Bucket->Free.IsEmpty())
+		{
+			ADronePawn* Drone = Bucket->Free.Pop(EAllowShrinking::No);
+			if (!IsValid(Drone))
+			{
+				continue;
+			}
+
+			Drone->ActivateFromPool(Location, Rotation);
+			HitSeconds += FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+			++Hits;
+			return Drone;
+		}
+	}
+
+	// 미스: 게임 중 실제 요청이 치른 스폰 비용 (절약량 비교 기준)
+	ADronePawn* Drone = SpawnDrone(Class, Location, Rotation);
+	MissSeconds += FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+	return Drone;
+}
+
+void UDronePoolSubsystem::ReleaseDrone(ADronePawn* Drone)
+{
+	const UDroneMovementComponent* Movement = Drone ? Drone->GetDroneMovement() : nullptr;
+	if (!IsValid(Drone) || (Movement && Movement->IsPooled()))
+	{
+		return;
+	}
+
+	++Releases;
+
+	FDronePoolBucket& Bucket = Buckets.FindOrAdd(Drone->GetClass());
+	if (Bucket.Free.Num() >= MaxPooledPerClass)
+	{
+		++Overflows;
+		Drone->Destroy();
+		return;
+	}
+
+	Drone->ReleaseToPool();
+	Drone->SetActorLocation(PoolLocation, false, nullptr, ETeleportType::ResetPhysics);
+	Bucket.Free.Add(Drone);
+}
+
+void UDronePoolSubsystem::LogStats() const
+{
+	const int64 Misses = Acquires - Hits;
+	const double AverageHitMs = Hits > 0 ? HitSeconds * 1000.0 / Hits : 0.0;
+	const double AverageMissMs = Misses > 0 ? MissSeconds * 1000.0 / Misses : 0.0;
+
+	int32 NumPooled = 0;
+	for (const TPair<UClass*, FDronePoolBucket>& Pair : Buckets)
+	{
+		NumPooled += Pair.Value.Free.Num();
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("DronePool: %lld acquires, %lld hits (%.1f%%), %lld releases, %lld overflows, %d pooled, acquire hit %.3f ms avg, miss %.3f ms avg (%lld misses), prewarm %lld spawns in %.1f ms"),
+		Acquires, Hits, Acquires > 0 ? 100.0 * Hits / Acquires : 0.0, Releases, Overflows, NumPooled,
+		AverageHitMs, AverageMissMs, Misses, PrewarmSpawns, PrewarmSeconds * 1000.0);
+
+	// 절약량은 같은 세션에서 실제로 스폰한 미스와 비교할 수 있을 때만 낸다 (미리 채운 스폰은 부하가 없는 시점이라 기준으로 쓰지 않는다)
+	if (Hits > 0 && Misses > 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("DronePool: %.1f ms acquire time saved by %lld hits"), Hits * FMath::Max(AverageMissMs - AverageHitMs, 0.0), Hits);
+	}
+}
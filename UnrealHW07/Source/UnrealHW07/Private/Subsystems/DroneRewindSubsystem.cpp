@@ -0,0 +1,306 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/DroneRewindSubsystem.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "DroneStats.h"
+#include "Engine/World.h"
+#include "PhysicsEngine/BodyInstance.h"
+
+void UDroneRewindSubsystem::FHistory::Push(const FDroneRewindSample& Sample)
+{
+	// 가득 차면 가장 오래된 것을 덮어쓴다
+	if (Num < Samples.Num())
+	{
+		Samples[(Head + Num) % Samples.Num()] = Sample;
+		++Num;
+	}
+	else
+	{
+		Samples[Head] = Sample;
+		Head = (Head + 1) % Samples.Num();
+	}
+}
+
+bool UDroneRewindSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDroneRewindSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 한 샘플 간격마다 기록 하나 + 멈췄다 움직일 때의 유지 샘플 하나가 들어갈 수 있어 양 끝에 여유를 둔다
+	SampleRate = FMath::Max(1.f, SampleRate);
+	HistorySize = FMath::CeilToInt32(MaxRewindTime * SampleRate) + 2;
+	NextSampleTime = 0.0;
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ThisClass::HandleWorldPostActorTick);
+}
+
+void UDroneRewindSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+	Histories.Empty();
+	HistoryIndices.Empty();
+
+	Super::Deinitialize();
+}
+
+void UDroneRewindSubsystem::RegisterDrone(UDroneMovementComponent* Drone)
+{
+	if (!Drone || HistoryIndices.Contains(Drone))
+	{
+		return;
+	}
+
+	FHistory& History = Histories.AddDefaulted_GetRef();
+	History.Drone = Drone;
+	History.Collision = Cast<UPrimitiveComponent>(Drone->UpdatedComponent);
+	if (History.Collision)
+	{
+		const FCollisionShape Shape = History.Collision->GetCollisionShape();
+		History.CollisionRadius = Shape.IsSphere() ? Shape.GetSphereRadius() : static_cast<float>(Shape.GetExtent().Size());
+	}
+
+	// 링 버퍼는 여기서 한 번만 할당
+	History.Samples.SetNum(HistorySize);
+
+	HistoryIndices.Add(Drone, Histories.Num() - 1);
+}
+
+void UDroneRewindSubsystem::UnregisterDrone(UDroneMovementComponent* Drone)
+{
+	int32 Index;
+	if (!HistoryIndices.RemoveAndCopyValue(Drone, Index))
+	{
+		return;
+	}
+
+	Histories.RemoveAtSwap(Index, EAllowShrinking::No);
+	if (Histories.IsValidIndex(Index))
+	{
+		HistoryIndices[Histories[Index].Drone] = Index;
+	}
+}
+
+void UDroneRewindSubsystem::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld() || TickType == LEVELTICK_TimeOnly)
+	{
+		return;
+	}
+
+	DRONE_TRACE_SCOPE(UDroneRewindSubsystem::RecordHistory);
+
+	const double Now = World->GetTimeSeconds();
+	if (Now < NextSampleTime)
+	{
+		return;
+	}
+
+	// 프레임이 샘플 간격보다 길면 밀린 만큼 몰아서 기록하지 않고 다음 프레임부터 다시 맞춘다
+	NextSampleTime = FMath::Max(NextSampleTime + 1.0 / SampleRate, Now);
+
+	for (FHistory& History : Histories)
+	{
+		RecordHistory(History, Now);
+	}
+}
+
+void UDroneRewindSubsystem::RecordHistory(FHistory& History, double Now)
+{
+	const USceneComponent* Updated = History.Drone ? History.Drone->UpdatedComponent : nullptr;
+	if (!Updated)
+	{
+		return;
+	}
+
+	FDroneRewindSample Sample;
+	Sample.Time = Now;
+	Sample.Location = Updated->GetComponentLocation();
+	Sample.Rotation = Updated->GetComponentRotation();
+	Sample.MovementMode = History.Drone->GetMovementMode();
+
+	if (History.Num > 0)
+	{
+		const FDroneRewindSample& Last = History.Get(History.Num - 1);
+		const bool bUnchanged = Last.MovementMode == Sample.MovementMode
+			&& Last.Location.Equals(Sample.Location, RecordLocationTolerance)
+			&& Last.Rotation.Equals(Sample.Rotation, KINDA_SMALL_NUMBER);
+		if (bUnchanged)
+		{
+			History.LastObservedTime = Now;
+			return;
+		}
+
+		// 멈춰 있다 다시 움직이면 직전 프레임까지 제자리였음을 남겨 보간이 구간 전체로 번지지 않게 한다
+		if (History.LastObservedTime > Last.Time)
+		{
+			FDroneRewindSample Hold = Last;
+			Hold.Time = History.LastObservedTime;
+			History.Push(Hold);
+		}
+	}
+
+	History.Push(Sample);
+	History.LastObservedTime = Now;
+}
+
+const UDroneRewindSubsystem::FHistory* UDroneRewindSubsystem::FindHistory(const UDroneMovementComponent* Drone) const
+{
+	const int32* Index = HistoryIndices.Find(Drone);
+	return Index ? &Histories[*Index] : nullptr;
+}
+
+double UDroneRewindSubsystem::ClampRewindTime(double Time) const
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	return FMath::Clamp(Time, Now - MaxRewindTime, Now);
+}
+
+bool UDroneRewindSubsystem::GetStateAtTime(const UDroneMovementComponent* Drone, double Time, FDroneRewindSample& OutSample) const
+{
+	const FHistory* History = FindHistory(Drone);
+	if (!History || History->Num == 0)
+	{
+		return false;
+	}
+
+	// 범위 밖이면 가장 가까운 끝 샘플
+	if (Time <= History->Get(0).Time)
+	{
+		OutSample = History->Get(0);
+		return true;
+	}
+	const FDroneRewindSample& Latest = History->Get(History->Num - 1);
+	if (Time >= Latest.Time)
+	{
+		// 마지막 샘플 이후는 현재 트랜스폼과 보간 (샘플 간격만큼 늦은 상태를 돌려주지 않는다)
+		const USceneComponent* Updated = History->Drone ? History->Drone->UpdatedComponent : nullptr;
+		const double Now = GetWorld()->GetTimeSeconds();
+		if (!Updated || Now <= Latest.Time)
+		{
+			OutSample = Latest;
+			return true;
+		}
+
+		const float Alpha = static_cast<float>(FMath::Min(1.0, (Time - Latest.Time) / (Now - Latest.Time)));
+		OutSample.Time = Time;
+		OutSample.Location = FMath::Lerp(Latest.Location, Updated->GetComponentLocation(), Alpha);
+		OutSample.Rotation = FQuat::Slerp(Latest.Rotation.Quaternion(), Updated->GetComponentQuat(), Alpha).Rotator();
+		OutSample.MovementMode = Latest.MovementMode;
+		return true;
+	}
+
+	// Time 보다 늦은 첫 샘플을 이진 탐색
+	int32 Low = 1;
+	int32 High = History->Num - 1;
+	while (Low < High)
+	{
+		const int32 Mid = (Low + High) / 2;
+		if (History->Get(Mid).Time <= Time)
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+
+	const FDroneRewindSample& Before = History->Get(Low - 1);
+	const FDroneRewindSample& After = History->Get(Low);
+	const float Alpha = static_cast<float>((Time - Before.Time) / (After.Time - Before.Time));
+
+	OutSample.Time = Time;
+	OutSample.Location = FMath::Lerp(Before.Location, After.Location, Alpha);
+	OutSample.Rotation = FQuat::Slerp(Before.Rotation.Quaternion(), After.Rotation.Quaternion(), Alpha).Rotator();
+	OutSample.MovementMode = Before.MovementMode;
+	return true;
+}
+
+bool UDroneRewindSubsystem::LineTraceRewound(const FVector& Start, const FVector& End, double Time, TConstArrayView<UDroneMovementComponent*> Candidates, FDroneRewindHit& OutHit) const
+{
+	DRONE_TRACE_SCOPE(UDroneRewindSubsystem::LineTraceRewound);
+
+	const double RewindTime = ClampRewindTime(Time);
+	const FVector Direction = End - Start;
+	const double DirectionSizeSq = Direction.SizeSquared();
+
+	OutHit = FDroneRewindHit();
+	for (UDroneMovementComponent* Drone : Candidates)
+	{
+		const FHistory* History = FindHistory(Drone);
+		FDroneRewindSample Sample;
+		if (!History || History->CollisionRadius <= 0.f || !GetStateAtTime(Drone, RewindTime, Sample))
+		{
+			continue;
+		}
+
+		// |Start + t * Direction - Center|^2 = Radius^2 의 작은 근
+		const FVector ToStart = Start - Sample.Location;
+		const double C = ToStart.SizeSquared() - FMath::Square(History->CollisionRadius);
+		if (C <= 0.0)
+		{
+			OutHit.Drone = Drone;
+			OutHit.Location = Start;
+			OutHit.Fraction = 0.f;
+			return true;
+		}
+		if (DirectionSizeSq <= UE_DOUBLE_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		const double B = FVector::DotProduct(ToStart, Direction);
+		const double Discriminant = B * B - DirectionSizeSq * C;
+		if (B >= 0.0 || Discriminant < 0.0)
+		{
+			continue;
+		}
+
+		const float Fraction = static_cast<float>((-B - FMath::Sqrt(Discriminant)) / DirectionSizeSq);
+		if (Fraction <= OutHit.Fraction)
+		{
+			OutHit.Drone = Drone;
+			OutHit.Location = Start + Direction * Fraction;
+			OutHit.Fraction = Fraction;
+		}
+	}
+
+	return OutHit.Drone != nullptr;
+}
+
+FDroneRewindScope::FDroneRewindScope(const UDroneRewindSubsystem& Subsystem, TConstArrayView<UDroneMovementComponent*> Drones, double Time)
+{
+	const double RewindTime = Subsystem.ClampRewindTime(Time);
+	for (UDroneMovementComponent* Drone : Drones)
+	{
+		const UDroneRewindSubsystem::FHistory* History = Subsystem.FindHistory(Drone);
+		FDroneRewindSample Sample;
+		if (!History || !History->Collision || !Subsystem.GetStateAtTime(Drone, RewindTime, Sample))
+		{
+			continue;
+		}
+
+		FBodyInstance* Body = History->Collision->GetBodyInstance();
+		if (!Body || !Body->IsValidBodyInstance())
+		{
+			continue;
+		}
+
+		const FTransform Transform = Body->GetUnrealWorldTransform();
+		Saved.Add({ Body, Transform });
+
+		Body->SetBodyTransform(FTransform(Sample.Rotation, Sample.Location, Transform.GetScale3D()), ETeleportType::TeleportPhysics, false);
+	}
+}
+
+FDroneRewindScope::~FDroneRewindScope()
+{
+	for (const FSavedTransform& Entry : Saved)
+	{
+		Entry.Body->SetBodyTransform(Entry.Transform, ETeleportType::TeleportPhysics, false);
+	}
+}
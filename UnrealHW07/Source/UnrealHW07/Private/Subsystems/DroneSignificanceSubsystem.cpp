@@ -0,0 +1,174 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/DroneSignificanceSubsystem.h"
+
+#include "Components/Camera/DroneCameraComponent.h"
+#include "Components/Movement/DroneMovementComponent.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+bool UDroneSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDroneSignificanceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 설정이 없으면 전부 최고 단계로 동작
+	if (Tiers.IsEmpty())
+	{
+		FDroneSignificanceTier& FullRate = Tiers.AddDefaulted_GetRef();
+		FullRate.bCameraUpdates = true;
+	}
+}
+
+void UDroneSignificanceSubsystem::Deinitialize()
+{
+	Drones.Empty();
+	Cameras.Empty();
+	TierIndices.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UDroneSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDroneSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void UDroneSignificanceSubsystem::RegisterDrone(UDroneMovementComponent* Drone)
+{
+	if (!Drone || Drones.Contains(Drone))
+	{
+		return;
+	}
+
+	Drones.Add(Drone);
+	Cameras.Add(Drone->GetOwner() ? Drone->GetOwner()->FindComponentByClass<UDroneCameraComponent>() : nullptr);
+	TierIndices.Add(INDEX_NONE);
+
+	RequestEvaluation();
+}
+
+void UDroneSignificanceSubsystem::UnregisterDrone(UDroneMovementComponent* Drone)
+{
+	const int32 Index = Drones.Find(Drone);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	Drones.RemoveAtSwap(Index, EAllowShrinking::No);
+	Cameras.RemoveAtSwap(Index, EAllowShrinking::No);
+	TierIndices.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void UDroneSignificanceSubsystem::Tick(float DeltaTime)
+{
+	TimeUntilEvaluation -= DeltaTime;
+	if (TimeUntilEvaluation > 0.f || Drones.IsEmpty())
+	{
+		return;
+	}
+
+	TimeUntilEvaluation = EvaluationInterval;
+	EvaluateSignificance();
+}
+
+void UDroneSignificanceSubsystem::EvaluateSignificance()
+{
+	// 모든 플레이어 시점 (데디케이티드 서버에서는 각 클라이언트의 시점)
+	TArray<FVector, TInlineAllocator<8>> ViewLocations;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PlayerController = It->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	// 정렬 키: 가장 가까운 시점까지의 거리 제곱, 조종 중인 드론은 음수로 맨 앞
+	struct FCandidate
+	{
+		double DistanceSq;
+		int32 DroneIndex;
+	};
+	TArray<FCandidate> Candidates;
+	Candidates.Reserve(Drones.Num());
+
+	for (int32 Index = 0; Index < Drones.Num(); ++Index)
+	{
+		const UDroneMovementComponent* Drone = Drones[Index];
+		const APawn* Pawn = Drone ? Drone->GetPawnOwner() : nullptr;
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		double DistanceSq = -1.0;
+		if (!Pawn->IsPlayerControlled())
+		{
+			DistanceSq = UE_DOUBLE_BIG_NUMBER;
+			const FVector Location = Pawn->GetActorLocation();
+			for (const FVector& ViewLocation : ViewLocations)
+			{
+				DistanceSq = FMath::Min(DistanceSq, FVector::DistSquared(Location, ViewLocation));
+			}
+		}
+
+		Candidates.Add({ DistanceSq, Index });
+	}
+
+	Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.DistanceSq < B.DistanceSq; });
+
+	// 가까운 순으로 단계를 채우고, 거리나 예산을 넘으면 다음 단계로 넘긴다
+	int32 TierIndex = 0;
+	int32 TierCount = 0;
+	const int32 LastTier = Tiers.Num() - 1;
+
+	for (const FCandidate& Candidate : Candidates)
+	{
+		while (TierIndex < LastTier)
+		{
+			const FDroneSignificanceTier& Tier = Tiers[TierIndex];
+			const bool bWithinDistance = Candidate.DistanceSq < 0.0 || Tier.MaxDistance <= 0.f || Candidate.DistanceSq <= FMath::Square(Tier.MaxDistance);
+			const bool bWithinBudget = Tier.MaxDrones <= 0 || TierCount < Tier.MaxDrones;
+			if (bWithinDistance && bWithinBudget)
+			{
+				break;
+			}
+			++TierIndex;
+			TierCount = 0;
+		}
+
+		++TierCount;
+		ApplyTier(Candidate.DroneIndex, TierIndex);
+	}
+}
+
+void UDroneSignificanceSubsystem::ApplyTier(int32 DroneIndex, int32 TierIndex)
+{
+	if (TierIndices[DroneIndex] == TierIndex)
+	{
+		return;
+	}
+	TierIndices[DroneIndex] = TierIndex;
+
+	const FDroneSignificanceTier& Tier = Tiers[TierIndex];
+
+	// 단계 전환 시 이동 컴포넌트는 밀린 시간을 다음 갱신에서 한 번에 적분한다
+	if (UDroneMovementComponent* Drone = Drones[DroneIndex])
+	{
+		Drone->SetSignificanceSettings(Tier.UpdateInterval, Tier.GroundTraceInterval);
+	}
+
+	if (UDroneCameraComponent* Camera = Cameras[DroneIndex])
+	{
+		Camera->SetCameraUpdatesEnabled(Tier.bCameraUpdates);
+	}
+}
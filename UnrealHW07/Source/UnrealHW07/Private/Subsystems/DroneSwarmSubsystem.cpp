@@ -0,0 +1,579 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Subsystems/DroneSwarmSubsystem.h"
+
+#include "DroneStats.h"
+#include "MassEntityManager.h"
+#include "MassEntitySubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SphereComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Mass/DroneSwarmFlight.h"
+#include "Mass/DroneSwarmFragments.h"
+#include "Misc/CommandLine.h"
+#include "Pawns/DronePawn.h"
+#include "Subsystems/DroneHeightFieldSubsystem.h"
+#include "Subsystems/DronePoolSubsystem.h"
+
+namespace DroneSwarm
+{
+	UDroneSwarmSubsystem* GetSwarm(UWorld* World)
+	{
+		UDroneSwarmSubsystem* Swarm = World ? World->GetSubsystem<UDroneSwarmSubsystem>() : nullptr;
+		UE_CLOG(!Swarm, LogTemp, Warning, TEXT("DroneSwarm: no game world"));
+		return Swarm;
+	}
+
+	// 첫 로컬 플레이어 시점 (없으면 원점)
+	FVector GetViewLocation(UWorld* World)
+	{
+		FVector ViewLocation = FVector::ZeroVector;
+		if (const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr)
+		{
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		}
+		return ViewLocation;
+	}
+
+	void SpawnCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		if (UDroneSwarmSubsystem* Swarm = GetSwarm(World))
+		{
+			const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+			const float Radius = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 50000.f;
+			Swarm->SpawnSwarm(Count, GetViewLocation(World), Radius);
+		}
+	}
+
+	void ClearCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		if (UDroneSwarmSubsystem* Swarm = GetSwarm(World))
+		{
+			Swarm->ClearSwarm();
+		}
+	}
+
+	void PossessNearestCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		UDroneSwarmSubsystem* Swarm = GetSwarm(World);
+		APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+		if (!Swarm || !PlayerController)
+		{
+			return;
+		}
+
+		if (ADronePawn* Pawn = Swarm->PromoteNearest(GetViewLocation(World)))
+		{
+			PlayerController->Possess(Pawn);
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs DroneSwarmSpawnCommand(
+	TEXT("drone.Swarm.Spawn"),
+	TEXT("Spawn ambient drones as Mass entities around the first player's view. Arguments: count (default 10000), radius in cm (default 50000)."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DroneSwarm::SpawnCommand));
+
+static FAutoConsoleCommandWithWorldAndArgs DroneSwarmClearCommand(
+	TEXT("drone.Swarm.Clear"),
+	TEXT("Destroy all swarm entities and uncontrolled promoted swarm drones."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DroneSwarm::ClearCommand));
+
+static FAutoConsoleCommandWithWorldAndArgs DroneSwarmPossessNearestCommand(
+	TEXT("drone.Swarm.PossessNearest"),
+	TEXT("Promote the swarm drone nearest to the first player's view to an ADronePawn and possess it."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DroneSwarm::PossessNearestCommand));
+
+bool UDroneSwarmSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDroneSwarmSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 엔티티/에셋/ISM 액터는 군집을 처음 스폰할 때 만든다 (군집을 쓰지 않는 맵과 클라이언트는 아무것도 로드하지 않는다)
+
+	// 무인 실행: -DroneSwarm=<count> 면 시작하자마자 군집 스폰
+	static bool bHandledCommandLine = false;
+	int32 Count = 0;
+	if (!bHandledCommandLine && InWorld.WorldType == EWorldType::Game && FParse::Value(FCommandLine::Get(), TEXT("DroneSwarm="), Count) && Count > 0)
+	{
+		bHandledCommandLine = true;
+		SpawnSwarm(Count, FVector::ZeroVector, 50000.f);
+	}
+}
+
+void UDroneSwarmSubsystem::Deinitialize()
+{
+	if (SwarmAssetsHandle.IsValid())
+	{
+		SwarmAssetsHandle->CancelHandle();
+		SwarmAssetsHandle.Reset();
+	}
+	PendingSpawns.Empty();
+
+	// 엔티티는 엔티티 매니저와 함께 사라지므로 슬롯만 비운다
+	InstanceEntities.Empty();
+	InstanceTransforms.Empty();
+	PromotionRequests.Empty();
+	PromotedDrones.Empty();
+	PromotedScriptPhases.Empty();
+	SwarmInstances = nullptr;
+	EntityManager = nullptr;
+
+	Super::Deinitialize();
+}
+
+TStatId UDroneSwarmSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDroneSwarmSubsystem, STATGROUP_Tickables);
+}
+
+bool UDroneSwarmSubsystem::EnsureInitialized()
+{
+	if (EntityManager)
+	{
+		return true;
+	}
+
+	UWorld* World = GetWorld();
+	UMassEntitySubsystem* EntitySubsystem = World->GetSubsystem<UMassEntitySubsystem>();
+	if (!EntitySubsystem)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DroneSwarm: Mass entity subsystem is not available"));
+		return false;
+	}
+
+	EntityManager = &EntitySubsystem->GetMutableEntityManager();
+	SwarmArchetype = EntityManager->CreateArchetype({
+		FDroneSwarmTransformFragment::StaticStruct(),
+		FDroneSwarmFlightFragment::StaticStruct(),
+		FDroneSwarmInstanceFragment::StaticStruct(),
+		FDroneSwarmTag::StaticStruct() });
+
+	// 비행 규칙은 승격할 드론 클래스의 이동 컴포넌트 기본값을 그대로 쓴다 (RequestSwarmAssets 에서 로드가 끝났다)
+	PawnClass = DroneClass.Get();
+	if (!PawnClass)
+	{
+		PawnClass = ADronePawn::StaticClass();
+	}
+
+	const ADronePawn* Template = GetDefault<ADronePawn>(PawnClass);
+	if (const UDroneMovementComponent* Movement = Template->GetDroneMovement())
+	{
+		FrameData.Params = Movement->GetKinematicsParams();
+		FrameData.bUseFixedTimestep = Movement->bUseFixedTimestep;
+		FrameData.FixedStep = 1.f / Movement->FixedTimestepRate;
+		FrameData.MaxSubsteps = Movement->MaxSubsteps;
+		FrameData.GroundProbeLength = Movement->GroundDetectionOffset;
+	}
+	if (const USphereComponent* Sphere = Cast<USphereComponent>(Template->GetRootComponent()))
+	{
+		FrameData.GroundProbeLength += Sphere->GetScaledSphereRadius();
+	}
+
+	FrameData.GroundReferenceZ = GroundReferenceZ;
+	FrameData.CruiseSpeed = CruiseSpeed;
+	FrameData.TurnRate = TurnRate;
+	FrameData.PromoteDistanceSq = FMath::Square(PromoteDistance);
+
+	if (const UDroneHeightFieldSubsystem* HeightFieldSubsystem = World->GetSubsystem<UDroneHeightFieldSubsystem>())
+	{
+		FrameData.HeightField = HeightFieldSubsystem->GetHeightField();
+	}
+
+	Random.Initialize(1234);
+
+#if !UE_SERVER
+	// 군집 전체를 인스턴스드 메시 하나로 그린다 (데디케이티드 서버는 렌더링하지 않음)
+	UStaticMesh* Mesh = SwarmMesh.Get();
+	if (Mesh && !IsRunningDedicatedServer())
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Name = TEXT("DroneSwarmInstances");
+		SpawnParameters.ObjectFlags = RF_Transient;
+		AActor* SwarmActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters);
+
+		SwarmInstances = NewObject<UInstancedStaticMeshComponent>(SwarmActor, TEXT("SwarmInstances"));
+		SwarmInstances->SetStaticMesh(Mesh);
+		SwarmInstances->SetMobility(EComponentMobility::Movable);
+		SwarmInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		SwarmInstances->SetCastShadow(false);
+		SwarmActor->SetRootComponent(SwarmInstances);
+		SwarmInstances->RegisterComponent();
+	}
+#endif
+
+	return true;
+}
+
+void UDroneSwarmSubsystem::SpawnSwarm(int32 Count, const FVector& Center, float Radius)
+{
+	// 군집 엔티티는 복제되지 않으므로 서버/스탠드얼론에서만 만든다 (클라이언트는 승격된 액터만 본다)
+	if (GetWorld()->GetNetMode() == NM_Client)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("DroneSwarm: swarms can only be spawned on the server"));
+		return;
+	}
+
+	// 첫 스폰은 드론 클래스/프록시 메시 비동기 로드가 끝난 뒤에 처리한다
+	if (!EntityManager)
+	{
+		PendingSpawns.Add({ Count, Center, Radius });
+		RequestSwarmAssets();
+		return;
+	}
+
+	SpawnEntities(Count, Center, Radius);
+}
+
+void UDroneSwarmSubsystem::RequestSwarmAssets()
+{
+	if (SwarmAssetsHandle.IsValid())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> AssetsToLoad;
+	if (!DroneClass.IsNull() && !DroneClass.IsValid())
+	{
+		AssetsToLoad.Add(DroneClass.ToSoftObjectPath());
+	}
+
+#if !UE_SERVER
+	// 데디케이티드 서버는 군집을 그리지 않으므로 메시를 로드하지 않는다
+	if (!IsRunningDedicatedServer() && !SwarmMesh.IsNull() && !SwarmMesh.IsValid())
+	{
+		AssetsToLoad.Add(SwarmMesh.ToSoftObjectPath());
+	}
+#endif
+
+	if (AssetsToLoad.IsEmpty())
+	{
+		HandleSwarmAssetsLoaded();
+		return;
+	}
+
+	SwarmAssetsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		AssetsToLoad, FStreamableDelegate::CreateUObject(this, &ThisClass::HandleSwarmAssetsLoaded));
+}
+
+void UDroneSwarmSubsystem::HandleSwarmAssetsLoaded()
+{
+	// 로드한 클래스/메시는 PawnClass 와 ISM 이 강참조로 잡는다
+	SwarmAssetsHandle.Reset();
+
+	TArray<FDronePendingSwarmSpawn> Spawns = MoveTemp(PendingSpawns);
+	PendingSpawns.Reset();
+	if (!EnsureInitialized())
+	{
+		return;
+	}
+
+	for (const FDronePendingSwarmSpawn& Spawn : Spawns)
+	{
+		SpawnEntities(Spawn.Count, Spawn.Center, Spawn.Radius);
+	}
+}
+
+void UDroneSwarmSubsystem::SpawnEntities(int32 Count, const FVector& Center, float Radius)
+{
+	DRONE_TRACE_SCOPE(UDroneSwarmSubsystem::SpawnSwarm);
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	TArray<FMassEntityHandle> Entities;
+	{
+		TSharedRef<FMassEntityManager::FEntityCreationContext> CreationContext = EntityManager->BatchCreateEntities(SwarmArchetype, Count, Entities);
+
+		const int32 FirstInstance = InstanceEntities.Num();
+		for (const FMassEntityHandle Entity : Entities)
+		{
+			// 원 안에 균일 분포
+			const float Angle = Random.FRandRange(0.f, UE_TWO_PI);
+			const float Distance = Radius * FMath::Sqrt(Random.FRand());
+			const FVector Location(Center.X + Distance * FMath::Cos(Angle), Center.Y + Distance * FMath::Sin(Angle), Center.Z + Random.FRandRange(500.f, 2000.f));
+			AddEntity(Entity, Location, Random.FRandRange(-180.f, 180.f), 0.f, EDroneMovementMode::Flying, Random.FRandRange(0.f, UE_TWO_PI));
+		}
+
+		if (SwarmInstances)
+		{
+			SwarmInstances->AddInstances(TArray<FTransform>(InstanceTransforms.GetData() + FirstInstance, Entities.Num()), false, true);
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("DroneSwarm: spawned %d drones in %.2f ms (%d total)"), Entities.Num(), (FPlatformTime::Seconds() - StartSeconds) * 1000.0, InstanceEntities.Num());
+
+	// 승격이 몰려도 스폰하지 않도록 동시 승격 한도만큼 풀을 채운다 (군집이 없는 월드는 미리 스폰하지 않는다)
+	UDronePoolSubsystem* Pool = GetWorld()->GetSubsystem<UDronePoolSubsystem>();
+	Pool->Prewarm(PawnClass, MaxPromotedDrones - PromotedDrones.Num() - Pool->GetNumPooled(PawnClass));
+}
+
+void UDroneSwarmSubsystem::ClearSwarm()
+{
+	// 로드를 기다리는 스폰도 취소한다 (로드 자체는 다음 스폰에서 재사용)
+	PendingSpawns.Reset();
+
+	if (EntityManager)
+	{
+		EntityManager->BatchDestroyEntities(InstanceEntities);
+	}
+	InstanceEntities.Reset();
+	InstanceTransforms.Reset();
+	PromotionRequests.Reset();
+
+	if (SwarmInstances)
+	{
+		SwarmInstances->ClearInstances();
+	}
+
+	UDronePoolSubsystem* Pool = GetWorld()->GetSubsystem<UDronePoolSubsystem>();
+	for (ADronePawn* Pawn : PromotedDrones)
+	{
+		if (IsValid(Pawn) && !Cast<APlayerController>(Pawn->GetController()))
+		{
+			Pool->ReleaseDrone(Pawn);
+		}
+	}
+	PromotedDrones.Reset();
+	PromotedScriptPhases.Reset();
+}
+
+int32 UDroneSwarmSubsystem::AddEntity(FMassEntityHandle Entity, const FVector& Location, float Yaw, float ZVelocity, EDroneMovementMode MovementMode, float ScriptPhase)
+{
+	const int32 InstanceIndex = InstanceEntities.Add(Entity);
+	InstanceTransforms.Add(FTransform(FRotator(0.f, Yaw, 0.f), Location));
+	PromotionRequests.Add(0);
+
+	FDroneSwarmTransformFragment& Transform = EntityManager->GetFragmentDataChecked<FDroneSwarmTransformFragment>(Entity);
+	Transform.Location = Location;
+	Transform.Yaw = Yaw;
+
+	FDroneSwarmFlightFragment& Flight = EntityManager->GetFragmentDataChecked<FDroneSwarmFlightFragment>(Entity);
+	Flight.ZVelocity = ZVelocity;
+	Flight.FixedStepAccumulator = 0.f;
+	Flight.ScriptPhase = ScriptPhase;
+	Flight.MovementMode = MovementMode;
+
+	EntityManager->GetFragmentDataChecked<FDroneSwarmInstanceFragment>(Entity).InstanceIndex = InstanceIndex;
+	return InstanceIndex;
+}
+
+void UDroneSwarmSubsystem::RemoveInstanceSlot(int32 InstanceIndex)
+{
+	// 마지막 슬롯을 빈 자리로 옮기고 ISM 도 마지막 인스턴스만 지운다 (중간 인스턴스를 지우면 뒤 인덱스가 모두 밀린다)
+	const int32 LastIndex = InstanceEntities.Num() - 1;
+	if (InstanceIndex != LastIndex)
+	{
+		InstanceEntities[InstanceIndex] = InstanceEntities[LastIndex];
+		InstanceTransforms[InstanceIndex] = InstanceTransforms[LastIndex];
+		PromotionRequests[InstanceIndex] = PromotionRequests[LastIndex];
+		EntityManager->GetFragmentDataChecked<FDroneSwarmInstanceFragment>(InstanceEntities[InstanceIndex]).InstanceIndex = InstanceIndex;
+
+		if (SwarmInstances)
+		{
+			SwarmInstances->UpdateInstanceTransform(InstanceIndex, InstanceTransforms[InstanceIndex], true, false, true);
+		}
+	}
+
+	InstanceEntities.RemoveAt(LastIndex, EAllowShrinking::No);
+	InstanceTransforms.RemoveAt(LastIndex, EAllowShrinking::No);
+	PromotionRequests.RemoveAt(LastIndex, EAllowShrinking::No);
+
+	if (SwarmInstances)
+	{
+		SwarmInstances->RemoveInstance(LastIndex);
+	}
+}
+
+void UDroneSwarmSubsystem::Tick(float DeltaTime)
+{
+	if (!EntityManager)
+	{
+		return;
+	}
+
+	DRONE_TRACE_SCOPE(UDroneSwarmSubsystem::Tick);
+
+	// 1. 이번 프레임 프로세서 결과를 렌더러에 한 번에 반영
+	UpdateInstances();
+
+	// 2. 승격/강등 (구조 변경은 처리 단계 밖인 여기서만 한다)
+	PromoteRequested();
+	DemoteDistant();
+
+	// 3. 다음 프레임 프로세서 입력과, 같은 스크립트 시각의 승격 폰 입력
+	UpdateFrameData(DeltaTime);
+	DrivePromoted(DeltaTime);
+}
+
+void UDroneSwarmSubsystem::UpdateInstances()
+{
+	if (SwarmInstances && !InstanceTransforms.IsEmpty())
+	{
+		SwarmInstances->BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true, false);
+	}
+}
+
+void UDroneSwarmSubsystem::PromoteRequested()
+{
+	// 뒤에서부터: 제거된 슬롯에는 이미 확인한 마지막 슬롯이 옮겨 온다
+	for (int32 Index = InstanceEntities.Num() - 1; Index >= 0 && PromotedDrones.Num() < MaxPromotedDrones; --Index)
+	{
+		if (PromotionRequests[Index])
+		{
+			PromoteInstance(Index);
+		}
+	}
+}
+
+void UDroneSwarmSubsystem::DemoteDistant()
+{
+	const double DemoteDistanceSq = FMath::Square(DemoteDistance);
+
+	for (int32 Index = PromotedDrones.Num() - 1; Index >= 0; --Index)
+	{
+		ADronePawn* Pawn = PromotedDrones[Index];
+		if (!IsValid(Pawn))
+		{
+			RemovePromotedAt(Index);
+			continue;
+		}
+
+		// 플레이어 (봇 포함) 가 조종 중인 드론은 강등하지 않는다
+		if (Cast<APlayerController>(Pawn->GetController()))
+		{
+			continue;
+		}
+
+		const FVector Location = Pawn->GetActorLocation();
+		bool bNearView = false;
+		for (const FVector& ViewLocation : FrameData.ViewLocations)
+		{
+			bNearView |= FVector::DistSquared(Location, ViewLocation) <= DemoteDistanceSq;
+		}
+
+		if (!bNearView)
+		{
+			DemotePawn(Pawn);
+		}
+	}
+}
+
+void UDroneSwarmSubsystem::DrivePromoted(float DeltaTime)
+{
+	// 컨트롤러가 없는 승격 드론은 다음 프레임 이동 컴포넌트가 소비할 입력으로 엔티티 스크립트를 이어 간다
+	for (int32 Index = 0; Index < PromotedDrones.Num(); ++Index)
+	{
+		ADronePawn* Pawn = PromotedDrones[Index];
+		UDroneMovementComponent* Movement = IsValid(Pawn) && !Pawn->GetController() ? Pawn->GetDroneMovement() : nullptr;
+		if (Movement)
+		{
+			DroneSwarmFlight::FillInputCommand(Movement->EditInputCommand(), *Movement, FrameData, PromotedScriptPhases[Index], DeltaTime);
+		}
+	}
+}
+
+void UDroneSwarmSubsystem::UpdateFrameData(float DeltaTime)
+{
+	FrameData.ScriptTime += DeltaTime;
+
+	// 모든 플레이어 시점 (데디케이티드 서버에서는 각 클라이언트의 시점)
+	FrameData.ViewLocations.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PlayerController = It->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			FrameData.ViewLocations.Add(ViewLocation);
+		}
+	}
+}
+
+ADronePawn* UDroneSwarmSubsystem::PromoteNearest(const FVector& Location)
+{
+	int32 NearestIndex = INDEX_NONE;
+	double NearestDistanceSq = UE_DOUBLE_BIG_NUMBER;
+	for (int32 Index = 0; Index < InstanceTransforms.Num(); ++Index)
+	{
+		const double DistanceSq = FVector::DistSquared(InstanceTransforms[Index].GetLocation(), Location);
+		if (DistanceSq < NearestDistanceSq)
+		{
+			NearestDistanceSq = DistanceSq;
+			NearestIndex = Index;
+		}
+	}
+
+	return NearestIndex != INDEX_NONE ? PromoteInstance(NearestIndex) : nullptr;
+}
+
+ADronePawn* UDroneSwarmSubsystem::PromoteInstance(int32 InstanceIndex)
+{
+	const FMassEntityHandle Entity = InstanceEntities[InstanceIndex];
+	const FDroneSwarmTransformFragment Transform = EntityManager->GetFragmentDataChecked<FDroneSwarmTransformFragment>(Entity);
+	const FDroneSwarmFlightFragment Flight = EntityManager->GetFragmentDataChecked<FDroneSwarmFlightFragment>(Entity);
+
+	// 승격/강등이 몰려도 스폰 비용이 없도록 풀에서 꺼낸다
+	UDronePoolSubsystem* Pool = GetWorld()->GetSubsystem<UDronePoolSubsystem>();
+	ADronePawn* Pawn = Pool->AcquireDrone(PawnClass, Transform.Location, FRotator(0.f, Transform.Yaw, 0.f));
+	if (!Pawn)
+	{
+		return nullptr;
+	}
+
+	// 엔티티 상태를 이어받는다 (풀에서 나온 드론은 착지 상태이므로 비행 중이면 폰의 비행 처리도 같이 실행된다)
+	if (UDroneMovementComponent* Movement = Pawn->GetDroneMovement())
+	{
+		Movement->CurrentZVelocity = Flight.ZVelocity;
+		Movement->SetMovementMode(Flight.MovementMode);
+	}
+
+	RemoveInstanceSlot(InstanceIndex);
+	EntityManager->DestroyEntity(Entity);
+
+	PromotedDrones.Add(Pawn);
+	PromotedScriptPhases.Add(Flight.ScriptPhase);
+	return Pawn;
+}
+
+void UDroneSwarmSubsystem::DemotePawn(ADronePawn* Pawn)
+{
+	const UDroneMovementComponent* Movement = Pawn->GetDroneMovement();
+	const FVector Location = Pawn->GetActorLocation();
+	const float Yaw = Pawn->GetActorRotation().Yaw;
+
+	// 승격 때 이어받은 위상을 돌려준다 (플레이어가 조종하다 놓은 드론도 원래 패턴으로 돌아간다)
+	const int32 PromotedIndex = PromotedDrones.Find(Pawn);
+	const float ScriptPhase = PromotedIndex != INDEX_NONE ? PromotedScriptPhases[PromotedIndex] : Random.FRandRange(0.f, UE_TWO_PI);
+
+	const int32 InstanceIndex = AddEntity(EntityManager->CreateEntity(SwarmArchetype), Location, Yaw,
+		Movement ? Movement->GetCurrentZVelocity() : 0.f,
+		Movement ? Movement->GetMovementMode() : EDroneMovementMode::Grounded,
+		ScriptPhase);
+
+	if (SwarmInstances)
+	{
+		SwarmInstances->AddInstance(InstanceTransforms[InstanceIndex], true);
+	}
+
+	if (PromotedIndex != INDEX_NONE)
+	{
+		RemovePromotedAt(PromotedIndex);
+	}
+	GetWorld()->GetSubsystem<UDronePoolSubsystem>()->ReleaseDrone(Pawn);
+}
+
+void UDroneSwarmSubsystem::RemovePromotedAt(int32 Index)
+{
+	PromotedDrones.RemoveAtSwap(Index, EAllowShrinking::No);
+	PromotedScriptPhases.RemoveAtSwap(Index, EAllowShrinking::No);
+}
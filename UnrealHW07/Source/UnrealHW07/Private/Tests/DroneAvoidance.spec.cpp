@@ -0,0 +1,154 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Physics/DroneAvoidance.h"
+#include "Subsystems/DroneAvoidanceSubsystem.h"
+#include "Tests/DroneTestWorld.h"
+
+namespace DroneAvoidanceSpec
+{
+	// 드론 한 대당 차지하는 평균 공간 (한 변) 과 비행 고도 범위
+	constexpr float Spacing = 400.f;
+	constexpr float AltitudeRange = 2000.f;
+
+	struct FFleet
+	{
+		TArray<FVector> Positions;
+		TArray<FVector> Velocities;
+
+		void Init(int32 NumDrones, int32 Seed)
+		{
+			FRandomStream Random(Seed);
+			const float Extent = Spacing * FMath::Sqrt(static_cast<float>(NumDrones));
+
+			Positions.SetNumUninitialized(NumDrones);
+			Velocities.SetNumUninitialized(NumDrones);
+			for (int32 Index = 0; Index < NumDrones; ++Index)
+			{
+				Positions[Index] = FVector(Random.FRandRange(0.f, Extent), Random.FRandRange(0.f, Extent), Random.FRandRange(0.f, AltitudeRange));
+				Velocities[Index] = FVector(Random.FRandRange(-400.f, 400.f), Random.FRandRange(-400.f, 400.f), Random.FRandRange(-100.f, 100.f));
+			}
+		}
+	};
+
+	// 모든 쌍을 거리 검사하는 기준 구현
+	void RunBruteForce(const FFleet& Fleet, const FDroneAvoidanceParams& Params, TArray<FVector>& OutSteering)
+	{
+		const int32 Num = Fleet.Positions.Num();
+		const double RadiusSq = FMath::Square(static_cast<double>(Params.NeighborRadius));
+		OutSteering.SetNumUninitialized(Num);
+
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			FVector Steering = FVector::ZeroVector;
+			for (int32 Other = 0; Other < Num; ++Other)
+			{
+				const FVector Offset = Fleet.Positions[Index] - Fleet.Positions[Other];
+				const double DistanceSq = Offset.SizeSquared();
+				if (Other != Index && DistanceSq <= RadiusSq)
+				{
+					Steering += DroneAvoidance::ComputePairSteering(Offset, DistanceSq, Fleet.Velocities[Index] - Fleet.Velocities[Other], Params);
+				}
+			}
+			OutSteering[Index] = Steering.GetClampedToMaxSize(Params.MaxSpeed);
+		}
+	}
+
+	// UDroneAvoidanceSubsystem 과 같은 경로 (해시 구축 후 드론마다 이웃 질의)
+	void RunSpatialHash(const FFleet& Fleet, const FDroneAvoidanceParams& Params, FDroneSpatialHash& Hash, TArray<FVector>& OutSteering)
+	{
+		const int32 Num = Fleet.Positions.Num();
+		OutSteering.SetNumUninitialized(Num);
+
+		Hash.Build(Fleet.Positions, Params.NeighborRadius);
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			OutSteering[Index] = DroneAvoidance::ComputeSteering(Hash, Index, Fleet.Positions, Fleet.Velocities, Params);
+		}
+	}
+
+	// 옆 드론 쪽으로 스윕 이동해 막혔는지 (확인 후 원래 위치로)
+	bool SweepBlocked(UDroneMovementComponent* Drone, const FVector& Delta)
+	{
+		UPrimitiveComponent* Primitive = Drone->UpdatedPrimitive;
+		const FVector Start = Primitive->GetComponentLocation();
+
+		FHitResult Hit;
+		Primitive->MoveComponent(Delta, Primitive->GetComponentQuat(), true, &Hit);
+		Primitive->SetWorldLocation(Start, false, nullptr, ETeleportType::TeleportPhysics);
+		return Hit.IsValidBlockingHit();
+	}
+}
+
+BEGIN_DEFINE_SPEC(FDroneAvoidanceSpec, "UnrealHW07.Drone.Avoidance", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FDroneAvoidanceSpec)
+
+void FDroneAvoidanceSpec::Define()
+{
+	Describe("Spatial hash steering", [this]()
+	{
+		// 같은 이웃 집합이어야 하므로 합산 순서 차이만큼만 달라야 한다
+		for (const int32 NumDrones : { 100, 1000, 5000 })
+		{
+			It(FString::Printf(TEXT("matches brute-force neighbor steering for %d drones"), NumDrones), [this, NumDrones]()
+			{
+				const FDroneAvoidanceParams Params;
+				DroneAvoidanceSpec::FFleet Fleet;
+				Fleet.Init(NumDrones, NumDrones);
+
+				TArray<FVector> HashSteering;
+				FDroneSpatialHash Hash;
+				uint64 StartCycles = FPlatformTime::Cycles64();
+				DroneAvoidanceSpec::RunSpatialHash(Fleet, Params, Hash, HashSteering);
+				const double HashMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+				TArray<FVector> BruteSteering;
+				StartCycles = FPlatformTime::Cycles64();
+				DroneAvoidanceSpec::RunBruteForce(Fleet, Params, BruteSteering);
+				const double BruteMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+				double MaxError = 0.0;
+				int32 Steered = 0;
+				for (int32 Index = 0; Index < NumDrones; ++Index)
+				{
+					MaxError = FMath::Max(MaxError, FVector::Dist(BruteSteering[Index], HashSteering[Index]));
+					Steered += BruteSteering[Index].IsZero() ? 0 : 1;
+				}
+
+				TestTrue(TEXT("Some drones are steered"), Steered > 0);
+				TestTrue(FString::Printf(TEXT("Max steering error %f"), MaxError), MaxError <= 1.e-2);
+				AddInfo(FString::Printf(TEXT("%d drones (%d steered): brute force %.3f ms, spatial hash %.3f ms"), NumDrones, Steered, BruteMs, HashMs));
+			});
+		}
+	});
+
+	Describe("Sweep collision", [this]()
+	{
+		It("ignores sweeps only between drones that both receive steering", [this]()
+		{
+			FDroneTestWorld TestWorld;
+			UDroneMovementComponent* First = TestWorld.SpawnDrone(FVector(0.f, 0.f, 1000.f));
+			UDroneMovementComponent* Second = TestWorld.SpawnDrone(FVector(200.f, 0.f, 1000.f));
+			const FVector Delta(400.f, 0.f, 0.f);
+
+			TestTrue(TEXT("Unsteered drones block each other"), DroneAvoidanceSpec::SweepBlocked(First, Delta));
+
+			UDroneAvoidanceSubsystem::SetDroneSweepsIgnored(First, true);
+			TestTrue(TEXT("Steered drone is still blocked by an unsteered (player) drone"), DroneAvoidanceSpec::SweepBlocked(First, Delta));
+			TestTrue(TEXT("Unsteered drone is still blocked by a steered drone"), DroneAvoidanceSpec::SweepBlocked(Second, -Delta));
+
+			UDroneAvoidanceSubsystem::SetDroneSweepsIgnored(Second, true);
+			TestFalse(TEXT("Two steered drones ignore each other"), DroneAvoidanceSpec::SweepBlocked(First, Delta));
+
+			UDroneAvoidanceSubsystem::SetDroneSweepsIgnored(First, false);
+			UDroneAvoidanceSubsystem::SetDroneSweepsIgnored(Second, false);
+			TestTrue(TEXT("Restored object type"), First->UpdatedPrimitive->GetCollisionObjectType() == ECC_Pawn);
+			TestTrue(TEXT("Restored drones block each other"), DroneAvoidanceSpec::SweepBlocked(First, Delta));
+		});
+	});
+}
+
+#endif
@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Controllers/DroneBotController.h"
+#include "Pawns/DronePawn.h"
+#include "Tests/DroneTestWorld.h"
+
+BEGIN_DEFINE_SPEC(FDroneBotControllerSpec, "UnrealHW07.Drone.BotController", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+	TUniquePtr<FDroneTestWorld> TestWorld;
+END_DEFINE_SPEC(FDroneBotControllerSpec)
+
+void FDroneBotControllerSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TestWorld = MakeUnique<FDroneTestWorld>();
+		TestWorld->SpawnFloor(0.f);
+	});
+
+	AfterEach([this]()
+	{
+		TestWorld.Reset();
+	});
+
+	Describe("LandingSpam", [this]()
+	{
+		// 스폰 높이 (200cm) 근처에서 떠 있기만 하던 회귀: 실제로 착지/이륙 전환을 반복해야 한다
+		It("lands, hops above its takeoff height and lands again", [this]()
+		{
+			// 봇은 사람과 같은 입력 액션을 주입하므로 입력 설정이 있는 드론 블루프린트가 필요하다
+			UClass* DroneClass = LoadClass<ADronePawn>(nullptr, TEXT("/Game/PlayerPawn/BP_Drone.BP_Drone_C"));
+			if (!TestNotNull(TEXT("Drone blueprint"), DroneClass))
+			{
+				return;
+			}
+
+			UWorld* World = TestWorld->GetWorld();
+			ADronePawn* Pawn = World->SpawnActor<ADronePawn>(DroneClass, FVector(0.f, 0.f, 200.f), FRotator::ZeroRotator);
+			ADroneBotController* Bot = World->SpawnActor<ADroneBotController>();
+			Bot->SetBehavior(EDroneBotBehavior::LandingSpam, 1);
+			Bot->Possess(Pawn);
+
+			// 입력 설정 로드를 끝내 봇이 바로 입력을 넣게 한다
+			FlushAsyncLoading();
+
+			const UDroneMovementComponent* Movement = Pawn->GetDroneMovement();
+			if (!TestNotNull(TEXT("Drone movement"), Movement))
+			{
+				return;
+			}
+
+			constexpr float DeltaTime = 1.f / 60.f;
+			constexpr int32 MaxFrames = 5 * 60;
+
+			TestTrue(TEXT("Landed after spawning in the air"), TestWorld->TickUntil(DeltaTime, MaxFrames, [Movement]() { return Movement->IsGrounded(); }));
+			const double GroundZ = Pawn->GetActorLocation().Z;
+
+			TestTrue(TEXT("Took off after waiting on the ground"), TestWorld->TickUntil(DeltaTime, MaxFrames, [Movement]() { return Movement->IsFlight(); }));
+
+			double PeakZ = GroundZ;
+			const bool bLandedAgain = TestWorld->TickUntil(DeltaTime, MaxFrames, [Movement, Pawn, &PeakZ]()
+			{
+				PeakZ = FMath::Max(PeakZ, Pawn->GetActorLocation().Z);
+				return Movement->IsGrounded();
+			});
+
+			TestTrue(TEXT("Landed again after the hop"), bLandedAgain);
+			TestTrue(FString::Printf(TEXT("Hop height %.1f cm"), PeakZ - GroundZ), PeakZ - GroundZ >= 99.0);
+		});
+	});
+}
+
+#endif
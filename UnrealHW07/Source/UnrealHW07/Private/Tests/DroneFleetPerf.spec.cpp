@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Subsystems/DroneFleetPerfSubsystem.h"
+#include "Tests/DroneTestWorld.h"
+
+BEGIN_DEFINE_SPEC(FDroneFleetPerfSpec, "UnrealHW07.Drone.FleetPerf", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+	TUniquePtr<FDroneTestWorld> TestWorld;
+END_DEFINE_SPEC(FDroneFleetPerfSpec)
+
+void FDroneFleetPerfSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TestWorld = MakeUnique<FDroneTestWorld>();
+	});
+
+	AfterEach([this]()
+	{
+		TestWorld.Reset();
+	});
+
+	It("runs every fleet size and writes one CSV row per fleet", [this]()
+	{
+		UDroneFleetPerfSubsystem* PerfSubsystem = TestWorld->GetWorld()->GetSubsystem<UDroneFleetPerfSubsystem>();
+		if (!TestNotNull(TEXT("Fleet perf subsystem"), PerfSubsystem))
+		{
+			return;
+		}
+
+		const TArray<int32> FleetSizes = { 1, 3 };
+		constexpr int32 MeasureFrames = 4;
+		PerfSubsystem->StartRun(FleetSizes, MeasureFrames, false);
+		TestTrue(TEXT("Run started"), PerfSubsystem->IsRunning());
+
+		// 워밍업 + 측정 + 플릿 사이 정리 프레임을 넉넉히 준다
+		const bool bFinished = TestWorld->TickUntil(1.f / 60.f, 1000, [PerfSubsystem]() { return !PerfSubsystem->IsRunning(); });
+		if (!TestTrue(TEXT("Run finished"), bFinished))
+		{
+			return;
+		}
+
+		const FString& Filename = PerfSubsystem->GetLastCsvFilename();
+		TArray<FString> Lines;
+		if (!TestTrue(TEXT("CSV written"), !Filename.IsEmpty() && FFileHelper::LoadFileToStringArray(Lines, *Filename)))
+		{
+			return;
+		}
+		IFileManager::Get().Delete(*Filename);
+
+		if (!TestEqual(TEXT("Header + one row per fleet"), Lines.Num(), FleetSizes.Num() + 1))
+		{
+			return;
+		}
+
+		TArray<FString> Header;
+		Lines[0].ParseIntoArray(Header, TEXT(","));
+		const int32 DronesColumn = Header.Find(TEXT("Drones"));
+		const int32 FramesColumn = Header.Find(TEXT("Frames"));
+		const int32 ComponentsColumn = Header.Find(TEXT("ComponentsPerDrone"));
+		if (!TestTrue(TEXT("Drones, Frames and ComponentsPerDrone columns"), DronesColumn != INDEX_NONE && FramesColumn != INDEX_NONE && ComponentsColumn != INDEX_NONE))
+		{
+			return;
+		}
+
+		for (int32 Row = 0; Row < FleetSizes.Num(); ++Row)
+		{
+			TArray<FString> Columns;
+			Lines[Row + 1].ParseIntoArray(Columns, TEXT(","), false);
+			if (!TestEqual(FString::Printf(TEXT("Row %d column count"), Row), Columns.Num(), Header.Num()))
+			{
+				continue;
+			}
+
+			TestEqual(FString::Printf(TEXT("Row %d drones"), Row), FCString::Atoi(*Columns[DronesColumn]), FleetSizes[Row]);
+			TestEqual(FString::Printf(TEXT("Row %d frames"), Row), FCString::Atoi(*Columns[FramesColumn]), MeasureFrames);
+
+			// 루트 충돌 구와 이동 컴포넌트는 어느 타깃에서나 있다
+			TestTrue(FString::Printf(TEXT("Row %d components per drone"), Row), FCString::Atof(*Columns[ComponentsColumn]) >= 2.f);
+		}
+	});
+}
+
+#endif
@@ -0,0 +1,275 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Physics/DroneKinematics.h"
+
+namespace DroneKinematicsSpec
+{
+	// 스칼라 Simulate 와 SoA IntegrateBatch 에 같은 입력을 주기 위한 드론 묶음
+	struct FFleet
+	{
+		TArray<float> ZVelocity;
+		TArray<float> DeltaZ;
+		TArray<float> LastStepOffsetZ;
+		TArray<float> FlyingMask;
+		TArray<float> PendingThrust;
+		TArray<float> StepDeltaTime;
+		TArray<float> NumSteps;
+		TArray<float> GravityZ;
+		TArray<float> MaxFallingSpeed;
+		TArray<float> MaxAscendingSpeed;
+		TArray<float> ThrustAccelZ;
+
+		// 드론마다 스텝 수를 0..MaxSteps 로 달리해 마스킹 경로도 지나가게 한다
+		void Init(int32 NumDrones, int32 MaxSteps, float StepDt)
+		{
+			FRandomStream Random(1234);
+			const FDroneKinematicsParams Defaults;
+
+			for (TArray<float>* Array : { &ZVelocity, &DeltaZ, &LastStepOffsetZ, &FlyingMask, &PendingThrust, &StepDeltaTime, &NumSteps, &GravityZ, &MaxFallingSpeed, &MaxAscendingSpeed, &ThrustAccelZ })
+			{
+				Array->SetNumZeroed(NumDrones);
+			}
+
+			for (int32 Index = 0; Index < NumDrones; ++Index)
+			{
+				ZVelocity[Index] = Random.FRandRange(Defaults.MaxFallingSpeed, Defaults.MaxAscendingSpeed);
+				FlyingMask[Index] = Random.FRand() < 0.5f ? 1.f : 0.f;
+				PendingThrust[Index] = Random.FRand() < 0.5f ? Random.FRandRange(-1.f, 1.f) * StepDt : 0.f;
+				StepDeltaTime[Index] = StepDt;
+				NumSteps[Index] = static_cast<float>(Random.RandRange(0, MaxSteps));
+				GravityZ[Index] = Defaults.GravityZ;
+				MaxFallingSpeed[Index] = Defaults.MaxFallingSpeed;
+				MaxAscendingSpeed[Index] = Defaults.MaxAscendingSpeed;
+				ThrustAccelZ[Index] = Defaults.ThrustAccelZ;
+			}
+		}
+
+		FDroneKinematicsBatchView GetView()
+		{
+			return FDroneKinematicsBatchView{
+				ZVelocity.GetData(), DeltaZ.GetData(), LastStepOffsetZ.GetData(),
+				FlyingMask.GetData(), PendingThrust.GetData(), StepDeltaTime.GetData(), NumSteps.GetData(),
+				GravityZ.GetData(), MaxFallingSpeed.GetData(), MaxAscendingSpeed.GetData(), ThrustAccelZ.GetData()
+			};
+		}
+
+		// 드론별 Simulate 호출 (컴포넌트 개별 Tick 경로와 같은 형태)
+		void RunScalar()
+		{
+			FDroneKinematicsParams Params;
+			for (int32 Index = 0; Index < ZVelocity.Num(); ++Index)
+			{
+				Params.GravityZ = GravityZ[Index];
+				Params.MaxFallingSpeed = MaxFallingSpeed[Index];
+				Params.MaxAscendingSpeed = MaxAscendingSpeed[Index];
+				Params.ThrustAccelZ = ThrustAccelZ[Index];
+
+				FDroneKinematicsState State;
+				State.ZVelocity = ZVelocity[Index];
+				State.bFlying = FlyingMask[Index] > 0.f;
+
+				DeltaZ[Index] = DroneKinematics::Simulate(State, static_cast<int32>(NumSteps[Index]), PendingThrust[Index], StepDeltaTime[Index], Params, LastStepOffsetZ[Index]);
+				ZVelocity[Index] = State.ZVelocity;
+			}
+		}
+
+		// UDroneMovementSubsystem 배치 경로와 같은 SoA 커널 (단일 스레드)
+		void RunBatched(int32 MaxSteps)
+		{
+			DroneKinematics::IntegrateBatch(GetView(), 0, ZVelocity.Num(), MaxSteps);
+		}
+	};
+}
+
+BEGIN_DEFINE_SPEC(FDroneKinematicsSpec, "UnrealHW07.Drone.Kinematics", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+	FDroneKinematicsParams Params;
+END_DEFINE_SPEC(FDroneKinematicsSpec)
+
+void FDroneKinematicsSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Params = FDroneKinematicsParams();
+	});
+
+	Describe("ApplyThrust", [this]()
+	{
+		It("accelerates by ThrustAccelZ per unit of impulse", [this]()
+		{
+			float ZVelocity = 0.f;
+			DroneKinematics::ApplyThrust(ZVelocity, 0.1f, Params);
+			TestEqual(TEXT("ZVelocity"), ZVelocity, 0.1f * Params.ThrustAccelZ);
+		});
+
+		It("clamps upward speed to MaxAscendingSpeed", [this]()
+		{
+			float ZVelocity = Params.MaxAscendingSpeed - 10.f;
+			DroneKinematics::ApplyThrust(ZVelocity, 1.f, Params);
+			TestEqual(TEXT("ZVelocity"), ZVelocity, Params.MaxAscendingSpeed);
+		});
+
+		It("clamps downward speed to MaxFallingSpeed", [this]()
+		{
+			float ZVelocity = Params.MaxFallingSpeed + 10.f;
+			DroneKinematics::ApplyThrust(ZVelocity, -1.f, Params);
+			TestEqual(TEXT("ZVelocity"), ZVelocity, Params.MaxFallingSpeed);
+		});
+	});
+
+	Describe("ApplyGravity", [this]()
+	{
+		It("adds GravityZ * DeltaTime", [this]()
+		{
+			float ZVelocity = 0.f;
+			DroneKinematics::ApplyGravity(ZVelocity, 0.1f, Params);
+			TestEqual(TEXT("ZVelocity"), ZVelocity, Params.GravityZ * 0.1f);
+		});
+
+		It("never falls faster than MaxFallingSpeed", [this]()
+		{
+			float ZVelocity = Params.MaxFallingSpeed + 1.f;
+			DroneKinematics::ApplyGravity(ZVelocity, 1.f, Params);
+			TestEqual(TEXT("ZVelocity"), ZVelocity, Params.MaxFallingSpeed);
+		});
+
+		It("slows an ascent without clamping it from above", [this]()
+		{
+			float ZVelocity = Params.MaxAscendingSpeed;
+			DroneKinematics::ApplyGravity(ZVelocity, 0.01f, Params);
+			TestTrue(TEXT("Gravity slows the ascent"), ZVelocity < Params.MaxAscendingSpeed);
+		});
+	});
+
+	Describe("ApplyVelocityReset", [this]()
+	{
+		It("limits a fast descent to VelocityResetThreshold on upward input", [this]()
+		{
+			float ZVelocity = -800.f;
+			TestTrue(TEXT("Reset applied"), DroneKinematics::ApplyVelocityReset(ZVelocity, 1.f, Params));
+			TestEqual(TEXT("ZVelocity"), ZVelocity, Params.VelocityResetThreshold);
+		});
+
+		It("keeps a descent already slower than the threshold", [this]()
+		{
+			float ZVelocity = -20.f;
+			TestTrue(TEXT("Reset applied"), DroneKinematics::ApplyVelocityReset(ZVelocity, 1.f, Params));
+			TestEqual(TEXT("ZVelocity"), ZVelocity, -20.f);
+		});
+
+		It("ignores downward input and ascending drones", [this]()
+		{
+			float Falling = -800.f;
+			TestFalse(TEXT("Downward input"), DroneKinematics::ApplyVelocityReset(Falling, -1.f, Params));
+			TestEqual(TEXT("Falling ZVelocity"), Falling, -800.f);
+
+			float Rising = 100.f;
+			TestFalse(TEXT("Ascending drone"), DroneKinematics::ApplyVelocityReset(Rising, 1.f, Params));
+			TestEqual(TEXT("Rising ZVelocity"), Rising, 100.f);
+		});
+	});
+
+	Describe("ResolveTransition", [this]()
+	{
+		It("lands a flying drone that touches ground without elevating", [this]()
+		{
+			TestTrue(TEXT("Land"), DroneKinematics::ResolveTransition(true, true, false) == EDroneKinematicsTransition::Land);
+		});
+
+		It("keeps a flying drone airborne while elevating over ground", [this]()
+		{
+			TestTrue(TEXT("None"), DroneKinematics::ResolveTransition(true, true, true) == EDroneKinematicsTransition::None);
+		});
+
+		It("takes off when ground is lost or elevating starts", [this]()
+		{
+			TestTrue(TEXT("Ground lost"), DroneKinematics::ResolveTransition(false, false, false) == EDroneKinematicsTransition::TakeOff);
+			TestTrue(TEXT("Elevating"), DroneKinematics::ResolveTransition(false, true, true) == EDroneKinematicsTransition::TakeOff);
+		});
+
+		It("does nothing for stable states", [this]()
+		{
+			TestTrue(TEXT("Grounded on ground"), DroneKinematics::ResolveTransition(false, true, false) == EDroneKinematicsTransition::None);
+			TestTrue(TEXT("Flying in the air"), DroneKinematics::ResolveTransition(true, false, false) == EDroneKinematicsTransition::None);
+		});
+	});
+
+	Describe("Step", [this]()
+	{
+		It("applies thrust but no gravity or offset while grounded", [this]()
+		{
+			FDroneKinematicsState State;
+			const float OffsetZ = DroneKinematics::Step(State, 0.1f, 1.f / 60.f, Params);
+			TestEqual(TEXT("OffsetZ"), OffsetZ, 0.f);
+			TestEqual(TEXT("ZVelocity"), State.ZVelocity, 0.1f * Params.ThrustAccelZ);
+		});
+
+		It("integrates position with the updated velocity while flying", [this]()
+		{
+			FDroneKinematicsState State;
+			State.bFlying = true;
+			const float StepDt = 1.f / 60.f;
+			const float OffsetZ = DroneKinematics::Step(State, 0.f, StepDt, Params);
+			TestEqual(TEXT("ZVelocity"), State.ZVelocity, Params.GravityZ * StepDt);
+			TestEqual(TEXT("OffsetZ"), OffsetZ, State.ZVelocity * StepDt);
+		});
+	});
+
+	Describe("IntegrateBatch", [this]()
+	{
+		// 4 개씩 벡터 루프와 스칼라 나머지를 모두 지나도록 4의 배수가 아닌 크기도 넣는다
+		for (const int32 NumDrones : { 1, 3, 4, 7, 64, 1001 })
+		{
+			It(FString::Printf(TEXT("matches the scalar kernel for %d drones"), NumDrones), [this, NumDrones]()
+			{
+				constexpr int32 MaxSteps = 4;
+				constexpr float StepDt = 1.f / 60.f;
+
+				DroneKinematicsSpec::FFleet ScalarFleet;
+				DroneKinematicsSpec::FFleet BatchedFleet;
+				ScalarFleet.Init(NumDrones, MaxSteps, StepDt);
+				BatchedFleet.Init(NumDrones, MaxSteps, StepDt);
+
+				ScalarFleet.RunScalar();
+				BatchedFleet.RunBatched(MaxSteps);
+
+				// 같은 규칙이므로 FMA 반올림 차이만 허용한다
+				constexpr float Tolerance = 1.e-3f;
+				for (int32 Index = 0; Index < NumDrones; ++Index)
+				{
+					if (!TestEqual(FString::Printf(TEXT("ZVelocity[%d]"), Index), BatchedFleet.ZVelocity[Index], ScalarFleet.ZVelocity[Index], Tolerance)
+						|| !TestEqual(FString::Printf(TEXT("DeltaZ[%d]"), Index), BatchedFleet.DeltaZ[Index], ScalarFleet.DeltaZ[Index], Tolerance)
+						|| !TestEqual(FString::Printf(TEXT("LastStepOffsetZ[%d]"), Index), BatchedFleet.LastStepOffsetZ[Index], ScalarFleet.LastStepOffsetZ[Index], Tolerance))
+					{
+						break;
+					}
+				}
+			});
+		}
+
+		It("reports scalar and batched cost per drone step", [this]()
+		{
+			constexpr int32 NumDrones = 100000;
+			constexpr int32 MaxSteps = 4;
+
+			DroneKinematicsSpec::FFleet Fleet;
+			Fleet.Init(NumDrones, MaxSteps, 1.f / 60.f);
+			uint64 StartCycles = FPlatformTime::Cycles64();
+			Fleet.RunScalar();
+			const double ScalarMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+			Fleet.Init(NumDrones, MaxSteps, 1.f / 60.f);
+			StartCycles = FPlatformTime::Cycles64();
+			Fleet.RunBatched(MaxSteps);
+			const double BatchedMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+			// 타이밍은 기기마다 달라 단정하지 않고 기록만 남긴다
+			AddInfo(FString::Printf(TEXT("%d drones, up to %d steps: scalar %.3f ms, batched %.3f ms"), NumDrones, MaxSteps, ScalarMs, BatchedMs));
+		});
+	});
+}
+
+#endif
@@ -0,0 +1,120 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/DroneTestWorld.h"
+
+BEGIN_DEFINE_SPEC(FDroneMovementComponentSpec, "UnrealHW07.Drone.MovementComponent", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+	TUniquePtr<FDroneTestWorld> TestWorld;
+END_DEFINE_SPEC(FDroneMovementComponentSpec)
+
+void FDroneMovementComponentSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TestWorld = MakeUnique<FDroneTestWorld>();
+		TestWorld->SpawnFloor(0.f);
+	});
+
+	AfterEach([this]()
+	{
+		TestWorld.Reset();
+	});
+
+	Describe("Sleep", [this]()
+	{
+		// 착지 시 수직 속도 리셋이 남긴 표시 때문에 배치/개별 Tick 드론이 잠들지 못하던 회귀
+		for (const EDroneMovementTickMode TickMode : { EDroneMovementTickMode::Batched, EDroneMovementTickMode::PerComponent })
+		{
+			const FString ModeName = StaticEnum<EDroneMovementTickMode>()->GetNameStringByValue(static_cast<int64>(TickMode));
+
+			It(FString::Printf(TEXT("puts a drone that lands in %s mode to sleep"), *ModeName), [this, TickMode]()
+			{
+				UDroneMovementComponent* Drone = TestWorld->SpawnDrone(FVector(0.f, 0.f, 300.f), TickMode);
+				TestEqual(TEXT("Registered with the batch subsystem"), Drone->IsBatched(), TickMode == EDroneMovementTickMode::Batched);
+
+				const bool bLanded = TestWorld->TickUntil(1.f / 60.f, 300, [Drone]() { return Drone->IsFlight(); })
+					&& TestWorld->TickUntil(1.f / 60.f, 300, [Drone]() { return Drone->IsGrounded(); });
+				TestTrue(TEXT("Drone fell and landed"), bLanded);
+
+				const bool bSlept = TestWorld->TickUntil(1.f / 60.f, 120, [Drone]() { return Drone->IsSleeping(); });
+				TestTrue(TEXT("Landed drone went to sleep"), bSlept);
+			});
+		}
+	});
+
+	Describe("Kinematics parameters", [this]()
+	{
+		// 배치 모드가 등록 시점에 복사한 파라미터를 계속 써서 런타임 변경이 무시되던 회귀
+		for (const EDroneMovementTickMode TickMode : { EDroneMovementTickMode::Batched, EDroneMovementTickMode::PerComponent })
+		{
+			const FString ModeName = StaticEnum<EDroneMovementTickMode>()->GetNameStringByValue(static_cast<int64>(TickMode));
+
+			It(FString::Printf(TEXT("applies a gravity change made after registration in %s mode"), *ModeName), [this, TickMode]()
+			{
+				UDroneMovementComponent* Drone = TestWorld->SpawnDrone(FVector(0.f, 0.f, 20000.f), TickMode);
+				Drone->SetMovementMode(EDroneMovementMode::Flying);
+				TestWorld->Tick(1.f / 60.f);
+				TestTrue(TEXT("Falling under default gravity"), Drone->GetCurrentZVelocity() < 0.f);
+
+				// 무중력이면 이후 수직 속도가 그대로 유지된다
+				FDroneMovementTestAccess::SetGravityZ(Drone, 0.f);
+				const float ZVelocity = Drone->GetCurrentZVelocity();
+				TestWorld->Tick(1.f / 60.f, 30);
+				TestEqual(TEXT("ZVelocity without gravity"), Drone->GetCurrentZVelocity(), ZVelocity, 0.01f);
+			});
+		}
+	});
+
+	Describe("Significance catch-up", [this]()
+	{
+		// 갱신 간격이 늘어난 가변 스텝 드론이 밀린 시간을 한 스텝으로 적분해 낙하 속도/위치가 어긋나던 회귀
+		for (const EDroneMovementTickMode TickMode : { EDroneMovementTickMode::Batched, EDroneMovementTickMode::PerComponent })
+		{
+			const FString ModeName = StaticEnum<EDroneMovementTickMode>()->GetNameStringByValue(static_cast<int64>(TickMode));
+
+			It(FString::Printf(TEXT("integrates a throttled variable-step drone like one updated every frame in %s mode"), *ModeName), [this, TickMode]()
+			{
+				constexpr float DeltaTime = 1.f / 60.f;
+				constexpr int32 NumFrames = 150;
+
+				// 바닥에서 먼 높이에서 자유 낙하 (최대 낙하 속도 클램프에 닿는 구간 포함)
+				UDroneMovementComponent* Reference = TestWorld->SpawnDrone(FVector(0.f, 0.f, 20000.f), TickMode);
+				UDroneMovementComponent* Throttled = TestWorld->SpawnDrone(FVector(500.f, 0.f, 20000.f), TickMode);
+				Reference->SetMovementMode(EDroneMovementMode::Flying);
+				Throttled->SetMovementMode(EDroneMovementMode::Flying);
+				Throttled->SetSignificanceSettings(0.5f, 0.f);
+
+				// 첫 프레임은 두 드론 모두 갱신된다
+				TestWorld->Tick(DeltaTime);
+
+				int32 NumCatchUps = 0;
+				double MaxLocationError = 0.0;
+				float MaxZVelocityError = 0.f;
+				double LastZ = Throttled->UpdatedComponent->GetComponentLocation().Z;
+				for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+				{
+					TestWorld->Tick(DeltaTime);
+
+					// 갱신된 프레임에서만 비교 (그 사이 위치는 멈춰 있다)
+					const double Z = Throttled->UpdatedComponent->GetComponentLocation().Z;
+					if (Z != LastZ)
+					{
+						++NumCatchUps;
+						MaxLocationError = FMath::Max(MaxLocationError, FMath::Abs(Z - Reference->UpdatedComponent->GetComponentLocation().Z));
+						MaxZVelocityError = FMath::Max(MaxZVelocityError, FMath::Abs(Throttled->GetCurrentZVelocity() - Reference->GetCurrentZVelocity()));
+						LastZ = Z;
+					}
+				}
+
+				TestTrue(FString::Printf(TEXT("Throttled drone caught up %d times"), NumCatchUps), NumCatchUps > 0 && NumCatchUps < NumFrames / 10);
+				TestTrue(FString::Printf(TEXT("Location error %.4f cm"), MaxLocationError), MaxLocationError < 0.5);
+				TestTrue(FString::Printf(TEXT("ZVelocity error %.4f cm/s"), MaxZVelocityError), MaxZVelocityError < 0.5f);
+			});
+		}
+	});
+}
+
+#endif
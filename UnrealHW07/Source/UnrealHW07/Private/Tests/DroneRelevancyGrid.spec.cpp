@@ -0,0 +1,217 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Net/DroneReplicationGraph.h"
+#include "Tests/DroneTestWorld.h"
+
+namespace DroneRelevancyGridSpec
+{
+	// 측정 맵 크기 (한 변) 와 최대 비행 고도
+	constexpr float MapExtent = 200000.f;
+	constexpr float MaxAltitude = 20000.f;
+	constexpr float GroundedFraction = 0.3f;
+
+	struct FFleet
+	{
+		TArray<FVector> Locations;
+		TArray<bool> GroundedFlags;
+		TArray<FVector> ViewLocations;
+
+		void Init(int32 NumDrones, int32 NumClients, int32 Seed)
+		{
+			FRandomStream Random(Seed);
+			Locations.SetNumUninitialized(NumDrones);
+			GroundedFlags.SetNumUninitialized(NumDrones);
+
+			for (int32 Index = 0; Index < NumDrones; ++Index)
+			{
+				GroundedFlags[Index] = Random.FRand() < GroundedFraction;
+				Locations[Index] = FVector(
+					Random.FRandRange(-MapExtent * 0.5f, MapExtent * 0.5f),
+					Random.FRandRange(-MapExtent * 0.5f, MapExtent * 0.5f),
+					GroundedFlags[Index] ? 0.f : Random.FRandRange(0.f, MaxAltitude));
+			}
+
+			// 클라이언트 시점은 각자 조종 중인 드론 위치 (절반은 드론 근처 상공)
+			ViewLocations.SetNumUninitialized(NumClients);
+			for (int32 Client = 0; Client < NumClients; ++Client)
+			{
+				ViewLocations[Client] = Locations[Random.RandHelper(NumDrones)];
+				if (Client % 2 == 1)
+				{
+					ViewLocations[Client].Z += Random.FRandRange(0.f, MaxAltitude);
+				}
+			}
+		}
+	};
+
+	bool IsRelevant(const FDroneRelevancyGrid& Grid, const FFleet& Fleet, int32 DroneIndex, const FVector& ViewLocation)
+	{
+		const FVector& Location = Fleet.Locations[DroneIndex];
+		const float CullDistance = Grid.GetCullDistance(Location, Fleet.GroundedFlags[DroneIndex], ViewLocation);
+		return FVector::DistSquared(Location, ViewLocation) <= FMath::Square(CullDistance);
+	}
+
+	// 모든 드론-시점 쌍을 같은 컬 규칙으로 검사
+	void GatherBruteForce(const FDroneRelevancyGrid& Grid, const FFleet& Fleet, const FVector& ViewLocation, TArray<int32>& OutRelevant)
+	{
+		OutRelevant.Reset();
+		for (int32 Index = 0; Index < Fleet.Locations.Num(); ++Index)
+		{
+			if (IsRelevant(Grid, Fleet, Index, ViewLocation))
+			{
+				OutRelevant.Add(Index);
+			}
+		}
+	}
+
+	// UDroneReplicationGraphNode_Grid3D 와 같은 경로: 닿는 셀만 훑고 셀 안 드론마다 컬 검사
+	void GatherGrid(const FDroneRelevancyGrid& Grid, const FFleet& Fleet, const FVector& ViewLocation, TArray<int32>& OutRelevant)
+	{
+		OutRelevant.Reset();
+		for (const FDroneRelevancyGrid::FCell& Cell : Grid.GetCells())
+		{
+			if (!Grid.IsCellInRange(Cell, ViewLocation))
+			{
+				continue;
+			}
+
+			for (const int32 DroneIndex : Cell.Items)
+			{
+				if (IsRelevant(Grid, Fleet, DroneIndex, ViewLocation))
+				{
+					OutRelevant.Add(DroneIndex);
+				}
+			}
+		}
+		OutRelevant.Sort();
+	}
+
+	void BuildGrid(FDroneRelevancyGrid& Grid, const FFleet& Fleet)
+	{
+		Grid.Reset();
+		for (int32 Index = 0; Index < Fleet.Locations.Num(); ++Index)
+		{
+			Grid.Add(Index, Fleet.Locations[Index]);
+		}
+	}
+}
+
+BEGIN_DEFINE_SPEC(FDroneRelevancyGridSpec, "UnrealHW07.Drone.RelevancyGrid", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FDroneRelevancyGridSpec)
+
+void FDroneRelevancyGridSpec::Define()
+{
+	Describe("Cull rule", [this]()
+	{
+		It("extends the cull distance with altitude up to the maximum", [this]()
+		{
+			const FDroneRelevancyGrid Grid;
+			const FDroneRelevancySettings& Settings = Grid.GetSettings();
+
+			TestEqual(TEXT("Grounded at ground level"), Grid.GetCullDistance(FVector::ZeroVector, true, FVector::ZeroVector), Settings.GroundedCullDistance);
+			TestEqual(TEXT("Flying at ground level"), Grid.GetCullDistance(FVector::ZeroVector, false, FVector::ZeroVector), Settings.FlyingCullDistance);
+			TestEqual(TEXT("High viewer"), Grid.GetCullDistance(FVector::ZeroVector, false, FVector(0.f, 0.f, 1000.f)),
+				Settings.FlyingCullDistance + 1000.f * Settings.AltitudeCullScale);
+			TestEqual(TEXT("Clamped"), Grid.GetCullDistance(FVector(0.f, 0.f, 1.0e6f), false, FVector::ZeroVector), Settings.MaxCullDistance);
+		});
+
+		It("lengthens the replication period with distance and when grounded", [this]()
+		{
+			const FDroneRelevancyGrid Grid;
+			const FDroneRelevancySettings& Settings = Grid.GetSettings();
+
+			TestEqual(TEXT("Near"), Grid.GetReplicationPeriod(Settings.NearDistance, false), Settings.NearPeriod);
+			TestEqual(TEXT("Mid"), Grid.GetReplicationPeriod(Settings.FarDistance, false), Settings.MidPeriod);
+			TestEqual(TEXT("Far"), Grid.GetReplicationPeriod(Settings.FarDistance + 1.f, false), Settings.FarPeriod);
+			TestEqual(TEXT("Grounded near"), Grid.GetReplicationPeriod(0.f, true), Settings.NearPeriod * Settings.GroundedPeriodScale);
+		});
+	});
+
+	Describe("Grid gather", [this]()
+	{
+		// 셀 건너뛰기가 관련 드론을 빠뜨리지 않는지: 같은 컬 규칙의 전수 검사와 결과가 같아야 한다
+		for (const int32 NumDrones : { 100, 1000, 5000 })
+		{
+			It(FString::Printf(TEXT("matches a brute-force pass with the same cull rule for %d drones"), NumDrones), [this, NumDrones]()
+			{
+				constexpr int32 NumClients = 32;
+
+				DroneRelevancyGridSpec::FFleet Fleet;
+				Fleet.Init(NumDrones, NumClients, NumDrones);
+
+				FDroneRelevancyGrid Grid;
+				DroneRelevancyGridSpec::BuildGrid(Grid, Fleet);
+
+				TArray<int32> Expected;
+				TArray<int32> Gathered;
+				int32 Mismatches = 0;
+				int64 Relevant = 0;
+				double BruteForceMs = 0.0;
+				double GridMs = 0.0;
+				for (const FVector& ViewLocation : Fleet.ViewLocations)
+				{
+					uint64 StartCycles = FPlatformTime::Cycles64();
+					DroneRelevancyGridSpec::GatherBruteForce(Grid, Fleet, ViewLocation, Expected);
+					BruteForceMs += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+					StartCycles = FPlatformTime::Cycles64();
+					DroneRelevancyGridSpec::GatherGrid(Grid, Fleet, ViewLocation, Gathered);
+					GridMs += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+					Mismatches += Expected == Gathered ? 0 : 1;
+					Relevant += Expected.Num();
+				}
+
+				TestEqual(TEXT("Viewers whose grid result differs from brute force"), Mismatches, 0);
+				AddInfo(FString::Printf(TEXT("%d drones, %d viewers, %d cells: %lld relevant pairs, brute force %.3f ms, grid %.3f ms"),
+					NumDrones, NumClients, Grid.GetCells().Num(), Relevant, BruteForceMs, GridMs));
+			});
+		}
+
+		It("drops emptied cells and keeps the rest on reset", [this]()
+		{
+			FDroneRelevancyGrid Grid;
+			const FDroneRelevancySettings& Settings = Grid.GetSettings();
+
+			const int32 FirstCell = Grid.Add(0, FVector::ZeroVector);
+			Grid.Add(1, FVector(Settings.CellSize * 3.f, 0.f, 0.f));
+			TestEqual(TEXT("Same cell for the same location"), Grid.Add(2, FVector(1.f, 1.f, 1.f)), FirstCell);
+			TestEqual(TEXT("Two cells"), Grid.GetCells().Num(), 2);
+
+			Grid.Reset();
+			Grid.Add(0, FVector::ZeroVector);
+			Grid.Reset();
+			TestEqual(TEXT("Only the cell reused after the first reset remains"), Grid.GetCells().Num(), 1);
+			TestTrue(TEXT("Remaining cell is empty"), Grid.GetCells()[0].Items.IsEmpty());
+		});
+	});
+
+	Describe("Grid node", [this]()
+	{
+		It("removes tracked drones by index and rejects unknown ones", [this]()
+		{
+			FDroneTestWorld TestWorld;
+			UDroneReplicationGraphNode_Grid3D* Node = NewObject<UDroneReplicationGraphNode_Grid3D>();
+
+			TArray<AActor*> Actors;
+			for (int32 Index = 0; Index < 3; ++Index)
+			{
+				Actors.Add(TestWorld.GetWorld()->SpawnActor<AActor>());
+				Node->NotifyAddNetworkActor(FNewReplicatedActorInfo(Actors.Last()));
+			}
+
+			// 가운데를 지우면 마지막 항목이 그 자리로 옮겨지고, 옮겨진 항목도 계속 지울 수 있어야 한다
+			TestTrue(TEXT("Remove middle"), Node->NotifyRemoveNetworkActor(FNewReplicatedActorInfo(Actors[1]), false));
+			TestFalse(TEXT("Remove middle again"), Node->NotifyRemoveNetworkActor(FNewReplicatedActorInfo(Actors[1]), false));
+			TestTrue(TEXT("Remove moved last"), Node->NotifyRemoveNetworkActor(FNewReplicatedActorInfo(Actors[2]), false));
+			TestTrue(TEXT("Remove first"), Node->NotifyRemoveNetworkActor(FNewReplicatedActorInfo(Actors[0]), false));
+			TestFalse(TEXT("Empty node"), Node->NotifyRemoveNetworkActor(FNewReplicatedActorInfo(Actors[0]), false));
+		});
+	});
+}
+
+#endif
@@ -0,0 +1,99 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Subsystems/DroneRewindSubsystem.h"
+#include "Tests/DroneTestWorld.h"
+
+BEGIN_DEFINE_SPEC(FDroneRewindSpec, "UnrealHW07.Drone.Rewind", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+	TUniquePtr<FDroneTestWorld> TestWorld;
+	UDroneRewindSubsystem* RewindSubsystem = nullptr;
+END_DEFINE_SPEC(FDroneRewindSpec)
+
+void FDroneRewindSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		TestWorld = MakeUnique<FDroneTestWorld>();
+		TestWorld->SpawnFloor(0.f);
+		RewindSubsystem = TestWorld->GetWorld()->GetSubsystem<UDroneRewindSubsystem>();
+	});
+
+	AfterEach([this]()
+	{
+		RewindSubsystem = nullptr;
+		TestWorld.Reset();
+	});
+
+	It("sizes the history to cover the maximum rewind time at the sample rate", [this]()
+	{
+		if (!TestNotNull(TEXT("Rewind subsystem"), RewindSubsystem))
+		{
+			return;
+		}
+
+		// 프레임레이트와 무관하게 MaxRewindTime 동안의 샘플이 모두 들어가야 한다
+		const float SamplesInWindow = RewindSubsystem->GetMaxRewindTime() * RewindSubsystem->GetSampleRate();
+		TestTrue(TEXT("History covers the rewind window"), RewindSubsystem->GetHistorySize() > SamplesInWindow);
+	});
+
+	// 되감기 스코프가 컴포넌트를 옮기면 TransformUpdated 로 잠든 드론이 깨어나던 회귀
+	It("moves a sleeping drone's body into the past without waking it", [this]()
+	{
+		if (!TestNotNull(TEXT("Rewind subsystem"), RewindSubsystem))
+		{
+			return;
+		}
+
+		constexpr float DeltaTime = 1.f / 60.f;
+		UDroneMovementComponent* Drone = TestWorld->SpawnDrone(FVector(0.f, 0.f, 1000.f));
+		FDroneMovementTestAccess::SetSleepDelay(Drone, 0.f);
+		RewindSubsystem->RegisterDrone(Drone);
+
+		const bool bSlept = TestWorld->TickUntil(DeltaTime, 30, [Drone]() { return Drone->IsFlight(); })
+			&& TestWorld->TickUntil(DeltaTime, 600, [Drone]() { return Drone->IsSleeping(); });
+		if (!TestTrue(TEXT("Drone fell, landed and slept"), bSlept))
+		{
+			return;
+		}
+
+		// 착지 직후 잠들었으므로 조금 전 상태는 아직 공중
+		UWorld* World = TestWorld->GetWorld();
+		const double RewindTime = World->GetTimeSeconds() - 0.25;
+		FDroneRewindSample Sample;
+		if (!TestTrue(TEXT("Past state recorded"), RewindSubsystem->GetStateAtTime(Drone, RewindTime, Sample)))
+		{
+			return;
+		}
+
+		UPrimitiveComponent* Collision = Cast<UPrimitiveComponent>(Drone->UpdatedComponent);
+		const FVector RestingLocation = Collision->GetComponentLocation();
+		if (!TestTrue(TEXT("Past state is above the resting location"), Sample.Location.Z > RestingLocation.Z + 60.f))
+		{
+			return;
+		}
+
+		// 과거 위치를 수평으로 지나는 선분: 되감은 동안만 드론에 맞아야 한다
+		const FVector TraceStart = Sample.Location + FVector(200.f, 0.f, 0.f);
+		const FVector TraceEnd = Sample.Location - FVector(200.f, 0.f, 0.f);
+		const FCollisionObjectQueryParams ObjectParams(ECC_Pawn);
+		FHitResult Hit;
+
+		{
+			UDroneMovementComponent* Drones[] = { Drone };
+			FDroneRewindScope RewindScope(*RewindSubsystem, Drones, RewindTime);
+
+			TestTrue(TEXT("Still sleeping inside the scope"), Drone->IsSleeping());
+			TestTrue(TEXT("Component not moved"), Collision->GetComponentLocation().Equals(RestingLocation));
+			TestTrue(TEXT("Engine trace hits the rewound body"), World->LineTraceSingleByObjectType(Hit, TraceStart, TraceEnd, ObjectParams) && Hit.GetComponent() == Collision);
+		}
+
+		TestTrue(TEXT("Still sleeping after the scope"), Drone->IsSleeping());
+		TestTrue(TEXT("Body restored"), Collision->GetBodyInstance()->GetUnrealWorldTransform().GetLocation().Equals(RestingLocation, 0.01));
+		TestFalse(TEXT("Engine trace misses after the scope"), World->LineTraceSingleByObjectType(Hit, TraceStart, TraceEnd, ObjectParams));
+	});
+}
+
+#endif
@@ -0,0 +1,217 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/Movement/DroneMovementComponent.h"
+#include "Net/DroneStateCodec.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+namespace DroneStateCodecSpec
+{
+	constexpr float UpdateDeltaTime = 1.f / 30.f;
+
+	struct FDroneSample
+	{
+		FVector Location;
+		FRotator Rotation;
+		float ZVelocity = 0.f;
+		EDroneMovementMode MovementMode = EDroneMovementMode::Grounded;
+		FVector Velocity;
+		float YawRate = 0.f;
+	};
+
+	// 절반은 착지 대기, 나머지는 비행하며 수평 이동/선회/상승 하강
+	void InitFleet(TArray<FDroneSample>& Fleet, int32 NumDrones, FRandomStream& Random)
+	{
+		Fleet.SetNum(NumDrones);
+		for (FDroneSample& Drone : Fleet)
+		{
+			Drone.Location = FVector(Random.FRandRange(-100000.f, 100000.f), Random.FRandRange(-100000.f, 100000.f), Random.FRandRange(0.f, 5000.f));
+			Drone.Rotation = FRotator(0.f, Random.FRandRange(-180.f, 180.f), 0.f);
+
+			if (Random.FRand() < 0.5f)
+			{
+				Drone.MovementMode = EDroneMovementMode::Flying;
+				Drone.Velocity = FVector(Random.FRandRange(-400.f, 400.f), Random.FRandRange(-400.f, 400.f), 0.f);
+				Drone.YawRate = Random.FRandRange(-90.f, 90.f);
+			}
+		}
+	}
+
+	void AdvanceFleet(TArray<FDroneSample>& Fleet, FRandomStream& Random)
+	{
+		for (FDroneSample& Drone : Fleet)
+		{
+			if (Drone.MovementMode != EDroneMovementMode::Flying)
+			{
+				continue;
+			}
+
+			Drone.ZVelocity = FMath::Clamp(Drone.ZVelocity + Random.FRandRange(-200.f, 200.f), -1000.f, 400.f);
+			Drone.Location += (Drone.Velocity + FVector(0.f, 0.f, Drone.ZVelocity)) * UpdateDeltaTime;
+			Drone.Rotation.Yaw = FRotator::NormalizeAxis(Drone.Rotation.Yaw + Drone.YawRate * UpdateDeltaTime);
+			Drone.Rotation.Pitch = FMath::Clamp(Drone.Rotation.Pitch + Random.FRandRange(-2.f, 2.f), -80.f, 80.f);
+			Drone.Rotation.Roll = FMath::Clamp(Drone.Rotation.Roll + Random.FRandRange(-2.f, 2.f), -30.f, 30.f);
+		}
+	}
+
+	FDroneQuantizedState Quantize(const FDroneSample& Drone, const FDroneStateQuantization& Settings)
+	{
+		return DroneStateCodec::Quantize(Drone.Location, Drone.Rotation, Drone.ZVelocity, Drone.MovementMode, Settings);
+	}
+
+	// FDroneNetState 를 비트 아카이브로 보냈다 받은 결과
+	FDroneNetState RoundTrip(FDroneNetState& State)
+	{
+		bool bSuccess = false;
+		FBitWriter Writer(0, true);
+		State.NetSerialize(Writer, nullptr, bSuccess);
+
+		FDroneNetState Received;
+		FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+		Received.NetSerialize(Reader, nullptr, bSuccess);
+		return Received;
+	}
+}
+
+BEGIN_DEFINE_SPEC(FDroneStateCodecSpec, "UnrealHW07.Drone.StateCodec", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+	FDroneStateQuantization Settings;
+END_DEFINE_SPEC(FDroneStateCodecSpec)
+
+void FDroneStateCodecSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Settings = FDroneStateQuantization();
+		Settings.PitchRange = FFloatInterval(-80.f, 80.f);
+		Settings.RollRange = FFloatInterval(-30.f, 30.f);
+	});
+
+	Describe("Quantize", [this]()
+	{
+		It("restores location within the position precision", [this]()
+		{
+			const FVector Location(12345.678f, -9876.543f, 321.f);
+			FVector OutLocation;
+			FRotator OutRotation;
+			float OutZVelocity = 0.f;
+			EDroneMovementMode OutMode;
+			DroneStateCodec::Dequantize(DroneStateCodec::Quantize(Location, FRotator(10.f, 20.f, 5.f), -250.f, EDroneMovementMode::Flying, Settings),
+				Settings, OutLocation, OutRotation, OutZVelocity, OutMode);
+
+			TestTrue(TEXT("Location error"), FVector::Dist(Location, OutLocation) <= Settings.PositionPrecision);
+			TestEqual(TEXT("ZVelocity"), OutZVelocity, -250.f, Settings.VelocityPrecision);
+			TestEqual(TEXT("Yaw"), OutRotation.Yaw, 20.0, 360.0 / (1 << Settings.YawBits));
+			TestTrue(TEXT("MovementMode"), OutMode == EDroneMovementMode::Flying);
+		});
+	});
+
+	Describe("Full and delta encoding", [this]()
+	{
+		It("round-trip a moving fleet bit-exactly and delta stays smaller than full", [this]()
+		{
+			constexpr int32 NumDrones = 200;
+			constexpr int32 NumUpdates = 60;
+
+			FRandomStream Random(1234);
+			TArray<DroneStateCodecSpec::FDroneSample> Fleet;
+			DroneStateCodecSpec::InitFleet(Fleet, NumDrones, Random);
+
+			// 기준 상태는 매 갱신 직전 상태 (손실 없이 바로 확인되는 경우)
+			TArray<FDroneQuantizedState> Baselines;
+			for (const DroneStateCodecSpec::FDroneSample& Drone : Fleet)
+			{
+				Baselines.Add(DroneStateCodecSpec::Quantize(Drone, Settings));
+			}
+
+			int64 FullBits = 0;
+			int64 DeltaBits = 0;
+			int32 Mismatches = 0;
+			double MaxLocationError = 0.0;
+			for (int32 Update = 0; Update < NumUpdates; ++Update)
+			{
+				DroneStateCodecSpec::AdvanceFleet(Fleet, Random);
+
+				TArray<FDroneQuantizedState> Current;
+				FBitWriter FullWriter(0, true);
+				FBitWriter DeltaWriter(0, true);
+				for (int32 Index = 0; Index < NumDrones; ++Index)
+				{
+					Current.Add(DroneStateCodecSpec::Quantize(Fleet[Index], Settings));
+					DroneStateCodec::WriteFull(FullWriter, Current[Index], Settings);
+					DroneStateCodec::WriteDelta(DeltaWriter, Current[Index], Baselines[Index], Settings);
+				}
+				FullBits += FullWriter.GetNumBits();
+				DeltaBits += DeltaWriter.GetNumBits();
+
+				FBitReader FullReader(FullWriter.GetData(), FullWriter.GetNumBits());
+				FBitReader DeltaReader(DeltaWriter.GetData(), DeltaWriter.GetNumBits());
+				for (int32 Index = 0; Index < NumDrones; ++Index)
+				{
+					FDroneQuantizedState FromFull;
+					FDroneQuantizedState FromDelta;
+					DroneStateCodec::ReadFull(FullReader, FromFull, Settings);
+					DroneStateCodec::ReadDelta(DeltaReader, FromDelta, Baselines[Index], Settings);
+					Mismatches += (FromFull == Current[Index] && FromDelta == Current[Index]) ? 0 : 1;
+
+					FVector Location;
+					FRotator Rotation;
+					float ZVelocity;
+					EDroneMovementMode MovementMode;
+					DroneStateCodec::Dequantize(FromDelta, Settings, Location, Rotation, ZVelocity, MovementMode);
+					MaxLocationError = FMath::Max(MaxLocationError, FVector::Dist(Location, Fleet[Index].Location));
+				}
+				TestFalse(TEXT("Full reader overflow"), FullReader.IsError());
+				TestFalse(TEXT("Delta reader overflow"), DeltaReader.IsError());
+
+				Baselines = MoveTemp(Current);
+			}
+
+			TestEqual(TEXT("Decoded states that differ from the encoded ones"), Mismatches, 0);
+			TestTrue(TEXT("Location error within precision"), MaxLocationError <= Settings.PositionPrecision);
+			TestTrue(TEXT("Delta smaller than full"), DeltaBits < FullBits);
+
+			const double TotalStates = static_cast<double>(NumDrones) * NumUpdates;
+			AddInfo(FString::Printf(TEXT("Bytes per drone per update: full %.2f, delta %.2f"), FullBits / 8.0 / TotalStates, DeltaBits / 8.0 / TotalStates));
+		});
+	});
+
+	Describe("FDroneNetState", [this]()
+	{
+		It("round-trips the move id and fixed-step state", [this]()
+		{
+			FDroneNetState State;
+			State.MoveId = 123456;
+			State.Location = FVector(1000.f, -2000.f, 300.f);
+			State.FixedStepAccumulator = 0.0071f;
+			State.InterpolationAlpha = 0.426f;
+
+			const FDroneNetState Received = DroneStateCodecSpec::RoundTrip(State);
+			TestEqual(TEXT("MoveId"), Received.MoveId, State.MoveId);
+			TestEqual(TEXT("FixedStepAccumulator"), Received.FixedStepAccumulator, State.FixedStepAccumulator);
+			TestEqual(TEXT("InterpolationAlpha"), Received.InterpolationAlpha, State.InterpolationAlpha);
+			TestTrue(TEXT("Location"), Received.Location.Equals(State.Location, 1.f));
+		});
+
+		It("sends locations outside the quantization extent at full precision", [this]()
+		{
+			const FDroneStateQuantization AckQuantization;
+
+			FDroneNetState State;
+			State.Location = FVector(AckQuantization.PositionExtent * 2.f + 0.3f, 0.f, 50.f);
+			State.Rotation = FRotator(5.f, 45.f, 0.f);
+			State.ZVelocity = AckQuantization.VelocityRange.Max + 100.f;
+			State.MovementMode = EDroneMovementMode::Flying;
+
+			const FDroneNetState Received = DroneStateCodecSpec::RoundTrip(State);
+			TestTrue(TEXT("Location not clamped"), Received.Location.Equals(State.Location, UE_KINDA_SMALL_NUMBER));
+			TestEqual(TEXT("ZVelocity not clamped"), Received.ZVelocity, State.ZVelocity);
+			TestTrue(TEXT("MovementMode"), Received.MovementMode == EDroneMovementMode::Flying);
+		});
+	});
+}
+
+#endif
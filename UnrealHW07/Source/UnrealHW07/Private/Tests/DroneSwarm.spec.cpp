@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Mass/DroneSwarmFlight.h"
+#include "Mass/DroneSwarmFragments.h"
+#include "Subsystems/DroneSwarmSubsystem.h"
+#include "Tests/DroneTestWorld.h"
+
+BEGIN_DEFINE_SPEC(FDroneSwarmSpec, "UnrealHW07.Drone.Swarm", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FDroneSwarmSpec)
+
+void FDroneSwarmSpec::Define()
+{
+	Describe("Entity flight", [this]()
+	{
+		// 승격/강등 경계에서 비행이 이어지려면 엔티티 적분과 스크립트 입력을 받은 이동 컴포넌트가 같은 궤적을 그려야 한다
+		// (기본값인 가변 스텝 컴포넌트와, 고정 스텝으로 바꾼 컴포넌트 모두)
+		for (const bool bUseFixedTimestep : { false, true })
+		{
+			const TCHAR* StepName = bUseFixedTimestep ? TEXT("a fixed-step") : TEXT("a default variable-step");
+
+			It(FString::Printf(TEXT("matches %s UDroneMovementComponent driven by the same script"), StepName), [this, bUseFixedTimestep]()
+			{
+				constexpr float DeltaTime = 1.f / 60.f;
+				constexpr int32 NumFrames = 240;
+
+				// 바닥 없이 높은 곳에서 비행 상태로 시작 (엔티티도 지면에 닿지 않게 기준 높이를 내린다)
+				FDroneTestWorld TestWorld;
+				UDroneMovementComponent* Drone = TestWorld.SpawnDrone(FVector(0.f, 0.f, 20000.f));
+				if (bUseFixedTimestep)
+				{
+					FDroneMovementTestAccess::SetFixedTimestep(Drone, 60.f);
+				}
+				Drone->SetMovementMode(EDroneMovementMode::Flying);
+
+				FDroneSwarmFrameData FrameData;
+				FrameData.Params = FDroneMovementTestAccess::GetKinematicsParams(Drone);
+				FrameData.bUseFixedTimestep = bUseFixedTimestep;
+				FrameData.FixedStep = 1.f / 60.f;
+				FrameData.MaxSubsteps = FDroneMovementTestAccess::GetMaxSubsteps(Drone);
+				FrameData.GroundReferenceZ = -1.0e6f;
+
+				FDroneSwarmTransformFragment Transform;
+				Transform.Location = Drone->UpdatedComponent->GetComponentLocation();
+				Transform.Yaw = Drone->UpdatedComponent->GetComponentRotation().Yaw;
+
+				FDroneSwarmFlightFragment Flight;
+				Flight.ScriptPhase = 1.f;
+				Flight.MovementMode = EDroneMovementMode::Flying;
+
+				double MaxLocationError = 0.0;
+				float MaxZVelocityError = 0.f;
+				float MaxYawError = 0.f;
+				for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+				{
+					DroneSwarmFlight::FillInputCommand(Drone->EditInputCommand(), *Drone, FrameData, Flight.ScriptPhase, DeltaTime);
+					TestWorld.Tick(DeltaTime);
+					DroneSwarmFlight::Simulate(Transform, Flight, FrameData, DeltaTime);
+					FrameData.ScriptTime += DeltaTime;
+
+					MaxLocationError = FMath::Max(MaxLocationError, FVector::Dist(Transform.Location, Drone->UpdatedComponent->GetComponentLocation()));
+					MaxZVelocityError = FMath::Max(MaxZVelocityError, FMath::Abs(Flight.ZVelocity - Drone->GetCurrentZVelocity()));
+					MaxYawError = FMath::Max(MaxYawError, FMath::Abs(FMath::FindDeltaAngleDegrees(Transform.Yaw, Drone->UpdatedComponent->GetComponentRotation().Yaw)));
+				}
+
+				// 스크립트가 실제로 드론을 움직였는지 (수평 순항 + 상승/하강)
+				TestTrue(TEXT("Cruised"), FVector::Dist2D(Transform.Location, FVector::ZeroVector) > FrameData.CruiseSpeed);
+				TestTrue(TEXT("Still flying"), Drone->IsFlight() && Flight.MovementMode == EDroneMovementMode::Flying);
+
+				TestTrue(FString::Printf(TEXT("Location error %.4f cm"), MaxLocationError), MaxLocationError < 1.0);
+				TestTrue(FString::Printf(TEXT("ZVelocity error %.4f cm/s"), MaxZVelocityError), MaxZVelocityError < 0.1f);
+				TestTrue(FString::Printf(TEXT("Yaw error %.4f deg"), MaxYawError), MaxYawError < 0.01f);
+			});
+		}
+
+		It("lands on the reference height and clears vertical velocity like the component", [this]()
+		{
+			FDroneSwarmFrameData FrameData;
+			FrameData.GroundProbeLength = 40.f;
+
+			FDroneSwarmTransformFragment Transform;
+			Transform.Location = FVector(0.f, 0.f, 30.f);
+
+			// 하강 구간의 위상 (추력 < 0 이면 상승 유지가 풀려 착지한다)
+			FDroneSwarmFlightFragment Flight;
+			Flight.ScriptPhase = UE_PI * 1.5f;
+			Flight.ZVelocity = -300.f;
+			Flight.MovementMode = EDroneMovementMode::Flying;
+
+			DroneSwarmFlight::Simulate(Transform, Flight, FrameData, FrameData.FixedStep);
+
+			// 착지 스텝에는 이번 프레임 추력만 남는다 (이전 하강 속도는 비워짐)
+			const float Thrust = DroneSwarmFlight::GetScriptThrust(FrameData.ScriptTime, Flight.ScriptPhase);
+			TestTrue(TEXT("Grounded"), Flight.MovementMode == EDroneMovementMode::Grounded);
+			TestEqual(TEXT("ZVelocity"), Flight.ZVelocity, Thrust * FrameData.FixedStep * FrameData.Params.ThrustAccelZ, 0.01f);
+		});
+	});
+}
+
+#endif
@@ -0,0 +1,163 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/Movement/DroneMovementComponent.h"
+#include "Components/SphereComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/WorldSettings.h"
+#include "Subsystems/DroneSignificanceSubsystem.h"
+
+/**
+ * 자동화 테스트에서 이동 컴포넌트의 비공개 상태를 설정/조회하는 통로.
+ * UDroneMovementComponent 가 friend 로 선언한다.
+ */
+struct FDroneMovementTestAccess
+{
+	static void SetTickMode(UDroneMovementComponent* Drone, EDroneMovementTickMode TickMode)
+	{
+		Drone->TickMode = TickMode;
+	}
+
+	static void SetSleepDelay(UDroneMovementComponent* Drone, float SleepDelay)
+	{
+		Drone->SleepDelay = SleepDelay;
+	}
+
+	static void SetFixedTimestep(UDroneMovementComponent* Drone, float Rate)
+	{
+		Drone->bUseFixedTimestep = true;
+		Drone->FixedTimestepRate = Rate;
+	}
+
+	static void SetGravityZ(UDroneMovementComponent* Drone, float GravityZ)
+	{
+		Drone->GravityZ = GravityZ;
+	}
+
+	static FDroneKinematicsParams GetKinematicsParams(const UDroneMovementComponent* Drone)
+	{
+		return Drone->GetKinematicsParams();
+	}
+
+	static int32 GetMaxSubsteps(const UDroneMovementComponent* Drone)
+	{
+		return Drone->MaxSubsteps;
+	}
+};
+
+/**
+ * 자동화 테스트용 게임 월드.
+ * 빈 Game 월드를 만들어 BeginPlay 까지 진행하므로, 배치 이동 같은 월드 서브시스템이 실제 게임과 같은 순서로 돈다.
+ * 드론은 구 루트 + UDroneMovementComponent 만 가진 APawn 이라 입력 설정이나 폰 데이터 로드 없이 바로 시뮬레이션된다.
+ */
+class FDroneTestWorld
+{
+public:
+	FDroneTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("DroneTestWorld"));
+
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+
+		// 게임 모드가 없으므로 액터 BeginPlay 는 직접 보낸다
+		if (!World->GetBegunPlay())
+		{
+			World->GetWorldSettings()->NotifyBeginPlay();
+		}
+	}
+
+	~FDroneTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	UWorld* GetWorld() const { return World; }
+
+	// 윗면이 TopZ 인 넓은 바닥 (ECC_Visibility 트레이스와 스윕 모두 막는다)
+	AStaticMeshActor* SpawnFloor(float TopZ = 0.f, float HalfExtent = 5000.f) const
+	{
+		AStaticMeshActor* Floor = World->SpawnActor<AStaticMeshActor>(FVector(0.f, 0.f, TopZ - 50.f), FRotator::ZeroRotator);
+		UStaticMeshComponent* MeshComponent = Floor->GetStaticMeshComponent();
+		MeshComponent->SetMobility(EComponentMobility::Movable);
+		MeshComponent->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+		MeshComponent->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+
+		// 기본 큐브는 한 변 100cm
+		Floor->SetActorScale3D(FVector(HalfExtent / 50.f, HalfExtent / 50.f, 1.f));
+		return Floor;
+	}
+
+	// 스폰 후 컴포넌트를 등록하므로 BeginPlay (서브시스템 등록) 는 TickMode 를 정한 뒤에 불린다
+	UDroneMovementComponent* SpawnDrone(const FVector& Location, EDroneMovementTickMode TickMode = EDroneMovementTickMode::Batched, float SphereRadius = 30.f) const
+	{
+		APawn* Pawn = World->SpawnActor<APawn>(Location, FRotator::ZeroRotator);
+
+		USphereComponent* SphereRoot = NewObject<USphereComponent>(Pawn, TEXT("SphereRoot"));
+		SphereRoot->InitSphereRadius(SphereRadius);
+		SphereRoot->SetCollisionProfileName(UCollisionProfile::Pawn_ProfileName);
+		Pawn->SetRootComponent(SphereRoot);
+		SphereRoot->RegisterComponent();
+		SphereRoot->SetWorldLocation(Location);
+
+		UDroneMovementComponent* Drone = NewObject<UDroneMovementComponent>(Pawn, TEXT("DroneMovement"));
+		FDroneMovementTestAccess::SetTickMode(Drone, TickMode);
+		Drone->SetUpdatedComponent(SphereRoot);
+		Drone->SetGroundDetectionSettings(10.f, SphereRadius);
+		Drone->RegisterComponent();
+		RemoveFromSignificance(Drone);
+		return Drone;
+	}
+
+	// 테스트 월드에는 플레이어 시점이 없어 모든 드론이 가장 먼 중요도 단계 (갱신 간격 증가) 로 떨어지므로,
+	// 매 프레임 비교하는 테스트는 중요도 관리에서 빼고 필요하면 SetSignificanceSettings 로 직접 정한다
+	void RemoveFromSignificance(UDroneMovementComponent* Drone) const
+	{
+		if (UDroneSignificanceSubsystem* SignificanceSubsystem = World->GetSubsystem<UDroneSignificanceSubsystem>())
+		{
+			SignificanceSubsystem->UnregisterDrone(Drone);
+		}
+	}
+
+	void Tick(float DeltaTime, int32 NumFrames = 1) const
+	{
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			World->Tick(LEVELTICK_All, DeltaTime);
+		}
+	}
+
+	// 조건을 만족할 때까지 (최대 MaxFrames) 틱하고 만족했는지 돌려준다
+	template<typename PredicateType>
+	bool TickUntil(float DeltaTime, int32 MaxFrames, PredicateType&& Predicate) const
+	{
+		for (int32 Frame = 0; Frame < MaxFrames; ++Frame)
+		{
+			if (Predicate())
+			{
+				return true;
+			}
+			World->Tick(LEVELTICK_All, DeltaTime);
+		}
+		return Predicate();
+	}
+
+private:
+	UWorld* World = nullptr;
+};
+
+#endif
@@ -0,0 +1,22 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DroneHeightFieldBakeCommandlet.generated.h"
+
+/**
+ * 맵의 정적 지형을 위에서 아래로 트레이스해 드론 지면 높이 캐시를 베이크한다.
+ * 사용법: -run=DroneHeightFieldBake -Map=/Game/Maps/MainMap [-CellSize=100] [-TileCells=64]
+ */
+UCLASS()
+class UNREALHW07_API UDroneHeightFieldBakeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDroneHeightFieldBakeCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -36,6 +36,10 @@ public:
 	// 고수준 카메라 전환 함수
 	void HandleLandingTransition(const FRotator& CurrentPawnRotation);
 
+	// 중요도가 낮은 드론은 카메라 보간과 카메라 붐 갱신을 모두 끈다
+	void SetCameraUpdatesEnabled(bool bEnabled);
+	bool AreCameraUpdatesEnabled() const { return bCameraUpdatesEnabled; }
+
 	// Getter
 	float GetCurrentCameraPitch() const { return CurrentCameraPitch; }
 	float GetCurrentCameraRoll() const { return CurrentCameraRoll; }
@@ -44,6 +48,7 @@ public:
 	
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
 private:
 	// 카메라 컴포넌트 참조
@@ -56,6 +61,7 @@ private:
 	float TargetCameraPitch = 0.f;
 	float TargetCameraRoll = 0.f;
 	bool bShouldInterpCamera = false;
+	bool bCameraUpdatesEnabled = true;
 
 	// 보간 설정
 	UPROPERTY(EditAnywhere, Category = "Camera")
@@ -65,6 +71,7 @@ private:
 	float CameraRollInterpSpeed = 3.f;
 
 	// 내부 함수
+	void SetInterpolationActive(bool bActive);  // 보간 플래그, Tick, 활성 보간 스탯을 함께 갱신
 	void ApplyCameraRotation();
 	bool IsInterpolationComplete() const;
 };
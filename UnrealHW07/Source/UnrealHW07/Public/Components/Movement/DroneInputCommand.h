@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DroneInputCommand.generated.h"
+
+/**
+ * 드론 한 대의 프레임 입력 명령.
+ * Enhanced Input 콜백이 기록하고 UDroneMovementComponent 가 Tick 에서 한 번 소비한다.
+ * 같은 프레임에 액션이 여러 번 발생하면 축 입력은 마지막 샘플이 남고, 시선 회전량(Look)은 누적된다.
+ */
+USTRUCT(BlueprintType)
+struct FDroneInputCommand
+{
+	GENERATED_BODY()
+
+	// 이동 축 (X: 좌우, Y: 전후)
+	UPROPERTY(BlueprintReadOnly)
+	FVector2D Move = FVector2D::ZeroVector;
+
+	// 감도가 적용된 시선 회전량 (X: Yaw, Y: Pitch, 프레임 안의 마우스 델타를 모두 더한다)
+	UPROPERTY(BlueprintReadOnly)
+	FVector2D Look = FVector2D::ZeroVector;
+
+	// 상승/하강 축
+	UPROPERTY(BlueprintReadOnly)
+	float Thrust = 0.f;
+
+	// 롤 축
+	UPROPERTY(BlueprintReadOnly)
+	float Roll = 0.f;
+
+	// 상승 입력 유지 여부 (프레임이 바뀌어도 유지)
+	UPROPERTY(BlueprintReadOnly)
+	bool bElevating = false;
+
+	// 상승 시작 시 하강 속도 리셋 요청
+	UPROPERTY(BlueprintReadOnly)
+	bool bVelocityReset = false;
+
+	// 이번 프레임 첫 입력 샘플 시각 (FPlatformTime::Seconds, 입력이 없거나 Shipping 빌드면 0)
+	UPROPERTY(BlueprintReadOnly)
+	double SampleTime = 0.0;
+
+	bool HasFrameInput() const
+	{
+		return !Move.IsNearlyZero() || !Look.IsNearlyZero() || !FMath::IsNearlyZero(Thrust) || !FMath::IsNearlyZero(Roll) || bVelocityReset;
+	}
+
+	// 프레임 단위 입력만 비움 (유지 상태인 bElevating 은 남긴다)
+	void ClearFrameInput()
+	{
+		Move = FVector2D::ZeroVector;
+		Look = FVector2D::ZeroVector;
+		Thrust = 0.f;
+		Roll = 0.f;
+		bVelocityReset = false;
+		SampleTime = 0.0;
+	}
+};
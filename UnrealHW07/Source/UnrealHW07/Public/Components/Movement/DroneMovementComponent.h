@@ -3,10 +3,18 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Components/Movement/DroneInputCommand.h"
 #include "GameFramework/PawnMovementComponent.h"
+#include "Net/DroneStateCodec.h"
 #include "DroneMovementComponent.generated.h"
 
+class FDroneHeightField;
+class UDroneFlightRecorderSubsystem;
+struct FDroneKinematicsParams;
+struct FDroneAsyncPhysicsDroneInput;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnMovementModeChanged);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGroundLookPitch, float, PitchDelta);
 
 UENUM(BlueprintType)
 enum class EDroneMovementMode : uint8
@@ -15,6 +23,113 @@ enum class EDroneMovementMode : uint8
 	Flying
 };
 
+UENUM(BlueprintType)
+enum class EDroneMovementTickMode : uint8
+{
+	// 컴포넌트가 직접 Tick (배치 서브시스템이 없을 때의 대체 경로)
+	PerComponent,
+	// UDroneMovementSubsystem 이 모든 드론을 한 번에 처리
+	Batched,
+	// 수직 운동/추력/지면 접촉을 Chaos 비동기 물리 스레드에서 처리.
+	// 프로젝트 설정의 Tick Physics Async (bTickPhysicsAsync, AsyncFixedTimeStepSize) 를 직접 켜야 하며, 꺼져 있으면 Batched 로 대체
+	AsyncPhysics
+};
+
+UENUM(BlueprintType)
+enum class EDroneGroundTraceMode : uint8
+{
+	// 매 Tick 게임 스레드에서 즉시 트레이스
+	Sync,
+	// 비동기 트레이스를 요청하고 다음 프레임에 결과를 소비 (1프레임 지연)
+	Async
+};
+
+/** 조종 중인 클라이언트가 서버로 보내는 한 프레임 분량의 입력 무브 */
+USTRUCT()
+struct FDroneNetMove
+{
+	GENERATED_BODY()
+
+	// 클라이언트가 무브마다 1 씩 올리는 번호 (무브 식별 및 순서 판정, 0 은 없음)
+	UPROPERTY()
+	uint32 MoveId = 0;
+
+	UPROPERTY()
+	float DeltaTime = 0.f;
+
+	UPROPERTY()
+	FVector2D Move = FVector2D::ZeroVector;
+
+	UPROPERTY()
+	FVector2D Look = FVector2D::ZeroVector;
+
+	UPROPERTY()
+	float Thrust = 0.f;
+
+	UPROPERTY()
+	float Roll = 0.f;
+
+	UPROPERTY()
+	bool bElevating = false;
+
+	UPROPERTY()
+	bool bVelocityReset = false;
+
+	static FDroneNetMove FromCommand(const FDroneInputCommand& Command, uint32 InMoveId, float InDeltaTime);
+	FDroneInputCommand ToCommand() const;
+};
+
+/** 무브 적용 후의 시뮬레이션 상태 (서버 확인 및 클라이언트 예측 결과 비교용) */
+USTRUCT()
+struct FDroneNetState
+{
+	GENERATED_BODY()
+
+	// 이 상태를 만든 마지막 무브의 MoveId
+	UPROPERTY()
+	uint32 MoveId = 0;
+
+	UPROPERTY()
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY()
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	float ZVelocity = 0.f;
+
+	UPROPERTY()
+	EDroneMovementMode MovementMode = EDroneMovementMode::Grounded;
+
+	// 고정 스텝 모드의 남은 시간과 보간 비율 (재시뮬레이션이 서버와 같은 스텝 경계에서 시작하도록)
+	UPROPERTY()
+	float FixedStepAccumulator = 0.f;
+
+	UPROPERTY()
+	float InterpolationAlpha = 0.f;
+
+	// 무브 번호 + DroneStateCodec 전체 인코딩 (기본 양자화 설정) + 고정 스텝 상태
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FDroneNetState> : public TStructOpsTypeTraitsBase2<FDroneNetState>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+/**
+ * 네트워크 모델 (클라이언트 예측 + 서버 보정):
+ * - 조종 중인 클라이언트(AutonomousProxy)는 매 프레임 입력을 FDroneNetMove 로 저장하고 바로 예측 시뮬레이션한 뒤 ServerMoves 로 보낸다
+ * - 서버는 원격 조종 드론을 받은 무브로만 진행하고, 처리한 마지막 무브의 결과를 ClientAckMove 로 돌려준다
+ * - 클라이언트는 확인된 무브까지 버리고, 예측 결과가 다르면 서버 상태로 되돌린 뒤 확인되지 않은 무브를 다시 시뮬레이션한다
+ * - 다른 클라이언트의 드론(SimulatedProxy)은 양자화/델타 압축된 ReplicatedState 를 따른다
+ * PIE 에서 Net Mode 를 Listen Server/Client 로 두고, 네트워크 에뮬레이션 설정이나 NetEmulation.PktLag / NetEmulation.PktLoss 로 지연/손실을 준다.
+ * 네트워크 게임에서는 무브 단위 시뮬레이션을 위해 배치/비동기 물리 서브시스템 대신 개별 Tick 경로를 쓴다.
+ */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class UNREALHW07_API UDroneMovementComponent : public UPawnMovementComponent
 {
@@ -23,13 +138,25 @@ class UNREALHW07_API UDroneMovementComponent : public UPawnMovementComponent
 public:
 	UDroneMovementComponent();
 
+	virtual void InitializeComponent() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual bool IsMoveInputIgnored() const override;
 	virtual void AddInputVector(FVector WorldVector, bool bForce = false) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// 입력 명령 버퍼: 입력 콜백이 기록하고 Tick 의 정해진 지점에서 한 번 소비
+	FDroneInputCommand& EditInputCommand();
+	const FDroneInputCommand& GetLastInputCommand() const { return LastInputCommand; }
+	void SetFlightInputSettings(float SpeedMultiplier, float InRollSpeed, const FFloatInterval& PitchRange, const FFloatInterval& RollRange);
 
 	// 드론 전용 이동 함수들
 	void AddMovementInput(const FVector2D& InputValue, float DeltaTime, float SpeedMultiplier = 1.0f);
 	void AddRotationInput(float YawDelta, float PitchDelta, float RollDelta, const FFloatInterval& PitchRange, const FFloatInterval& RollRange);
+	void AddYawInput(float YawDelta);
+
+	// 이번 프레임에 모인 회전 (다음 커밋에서 이동과 함께 한 번에 반영)
+	void QueueRotation(const FRotator& NewRotation);
+	FRotator GetPendingRotation() const;
 
 	// 추력 제어
 	void AddThrust(float ThrustInput, float DeltaTime);
@@ -37,6 +164,9 @@ public:
 	void SetVerticalVelocity(float NewVelocity);
 	void ApplyVelocityReset(float InputValue);
 
+	// 고정 스텝 모드에서 시뮬레이션 상태 사이를 보간해 보여줄 컴포넌트 (루트의 자식)
+	void AddInterpolatedComponent(USceneComponent* Component);
+
 	// 상태 관리
 	void SetMovementMode(EDroneMovementMode NewMode);
 	EDroneMovementMode GetMovementMode() const { return MovementMode; }
@@ -46,37 +176,290 @@ public:
 
 	// 상태 조회
 	float GetCurrentZVelocity() const { return CurrentZVelocity; }
+	float GetCachedGroundDistance() const { return CachedGroundDistance; }
+	float GetFlyingMoveSpeed() const { return MoveSpeed * FlyingSpeedMultiplier; }
 	bool IsMoving() const;
 	bool ShouldApplyPhysics() const;
 
 
 	bool IsGrounded() const { return MovementMode == EDroneMovementMode::Grounded; }
 	bool IsFlight() const { return MovementMode == EDroneMovementMode::Flying; }
+	bool IsBatched() const { return BatchIndex != INDEX_NONE; }
+	bool IsAsyncPhysics() const { return AsyncPhysicsId != 0; }
+
+	// 슬립: 입력/추력/속도가 없는 착지 상태면 Tick 을 멈추고 입력이나 지지 지면 변화 시 깨어남
+	void WakeUp();
+	bool IsSleeping() const { return bIsSleeping; }
+
+	// 중요도 LOD: 이동 갱신 간격과 지면 프로브 최소 간격 (UDroneSignificanceSubsystem 에서 설정)
+	void SetSignificanceSettings(float UpdateInterval, float GroundTraceInterval);
+
+	// 네트워크 예측: 조종 주체가 바뀌면 저장된 무브와 서버 측 순서 기록을 비운다
+	void ResetNetPrediction();
+
+	// 풀링 (UDronePoolSubsystem): 반납 중에는 시뮬레이션과 중요도/지연 보상 등록을 멈추고,
+	// 상태를 스폰 직후로 되돌린다 (컴포넌트 등록과 델리게이트 바인딩은 유지)
+	void SetPooled(bool bInPooled);
+	bool IsPooled() const { return bIsPooled; }
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
-	// 물리 계산
+	friend class UDroneMovementSubsystem;
+	friend class UDroneFlightRecorderSubsystem;
+	friend class UDroneSwarmSubsystem;
+	friend class UDroneAvoidanceSubsystem;
+	friend struct FDroneMovementTestAccess;
+
+	bool CanSimulate() const;
+
+	// 비동기 물리 모드일 때만 다음 입력에서 물리 스레드 속도를 덮어쓰도록 표시
+	void MarkVelocityOverride();
+
+	// 입력 소비 → 지면 감지 → 적분 → 커밋까지 한 프레임 시뮬레이션 (개별 Tick, 서버 무브 처리, 재시뮬레이션 공용)
+	void SimulateFrame(float DeltaTime);
+
+	// 입력 명령 소비 (지면 감지/적분 전에 호출)
+	void ConsumeInputCommand(float DeltaTime);
+
+	// 네트워크 예측/보정
+	void RefreshStateQuantization();
+	bool ShouldSimulateLocally() const;
+	float ConsumeNetMoveTimeBudget(float MoveDeltaTime);
+	bool IsNetPredicting() const { return GetOwnerRole() == ROLE_AutonomousProxy; }
+	FDroneNetState CaptureNetState(uint32 MoveId) const;
+	bool HasPredictionError(const FDroneNetState& Predicted, const FDroneNetState& Server) const;
+	void SavePredictedMove(const FDroneNetMove& Move);
+	void ApplyServerCorrection(const FDroneNetState& ServerState);
+	void BroadcastMovementModeChanged();
+
+	UFUNCTION(Server, Unreliable)
+	void ServerMoves(const TArray<FDroneNetMove>& Moves);
+
+	UFUNCTION(Client, Unreliable)
+	void ClientAckMove(const FDroneNetState& ServerState);
+
+	UFUNCTION()
+	void OnRep_ReplicatedState();
+
+	void UpdateReplicatedState();
+
+	// 중요도 LOD: 갱신 시점 판정과 밀린 시간 소비
+	bool IsSimUpdateDue() const;
+	float ConsumeSimElapsedTime(float DeltaTime);
+
+	// 슬립 관리
+	bool CanSleep() const;
+	void UpdateSleepState();
+	void GoToSleep();
+	void UnbindSleepWakeEvents();
+	void HandleSleepTransformUpdated(USceneComponent* MovedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	UFUNCTION()
+	void HandleSupportActorDestroyed(AActor* DestroyedActor);
+
+	// 물리 계산 (규칙은 DroneKinematics 커널에 위임)
+	FDroneKinematicsParams GetKinematicsParams() const;
 	void ApplyGravity(float DeltaTime);
-	void ApplyVerticalMovement(float DeltaTime);
+	void QueueVerticalOffset(float OffsetZ);
+	FVector QueueMovementOffset(const FVector2D& ScaledInput, float DeltaTime);
+	void CommitPendingMove();
+
+	// 드론 간 회피 조향을 받는 드론인지 (원격 플레이어가 조종하는 드론 제외), 이번 프레임 이동에 섞을지 (그중 비행 중)
+	bool ReceivesAvoidanceSteering() const;
+	bool ShouldApplyAvoidance() const;
+
+	// 시뮬레이션 스텝
+	int32 AdvanceSimClock(float DeltaTime, float& OutStepDeltaTime);
+	float GetStepThrust(float StepDeltaTime) const;
+	float SimulateSteps(int32 NumSteps, float StepDeltaTime);
+	void FinishSimFrame(float SimulatedTime);
+	void ApplyVisualInterpolation();
+
+	// 비동기 물리 모드
+	void BuildAsyncPhysicsInput(FDroneAsyncPhysicsDroneInput& OutInput);
+	void ApplyAsyncPhysicsResults();
 
 	// 지면 감지
 	void PerformGroundTrace();
+	void PerformAsyncGroundTrace(const FVector& Start, const FVector& End);
+	void HandleGroundProbeResult(const FVector& ProbeLocation, bool bHit, float HitDistance, float ProbeLength, UPrimitiveComponent* HitComponent = nullptr);
+	void DiscardAsyncGroundTrace();
+	void RequestReplayGroundTrace(const FVector& Start, const FVector& End);
+	bool SampleBakedGroundDistance(const FVector& Location, float& OutDistance) const;
+	void ValidateBakedGroundDistance(const FVector& Location, float CachedDistance) const;
+
+	// 예측 지면 감지 스케줄링
+	bool CanSkipGroundTrace(const FVector& Location) const;
+	void ScheduleNextGroundTrace();
+	float ComputeEarliestTimeToGround(float FallDistance) const;
+	void InvalidateGroundTraceSchedule() { NextGroundTraceTime = 0.0; }
 
 	// 이동 상태
 	EDroneMovementMode MovementMode = EDroneMovementMode::Grounded;
 
+	// 시뮬레이티드 프록시용 트랜스폼/속도/이동 상태 (서버에서만 기록)
+	UPROPERTY(ReplicatedUsing = OnRep_ReplicatedState)
+	FDroneReplicatedState ReplicatedState;
+
+	// 보정 후 재시뮬레이션 중에는 중간 상태 전환 델리게이트를 보내지 않는다
+	bool bSuppressModeEvents = false;
+
 	// 물리 상태
 	float CurrentZVelocity = 0.f;
 
 	// 입력 상태
 	bool bIsElevating = false;
 
+	FDroneInputCommand InputCommand;
+	FDroneInputCommand LastInputCommand;
+
+	// 소비했지만 아직 트랜스폼에 반영되지 않은 가장 오래된 입력 시각 (지연 측정용, 없으면 0, Shipping 에서는 항상 0)
+	double PendingLatencySampleTime = 0.0;
+
+	// 비행 입력 설정 (ADronePawn 에서 전달)
+	float FlyingSpeedMultiplier = 1.f;
+	float RollSpeed = 60.f;
+	FFloatInterval FlyingPitchRange = FFloatInterval(-80.f, 80.f);
+	FFloatInterval FlyingRollRange = FFloatInterval(-30.f, 30.f);
+
+	// 프레임 단위로 모았다가 한 번에 커밋하는 트랜스폼 변화량
+	FVector PendingTranslation = FVector::ZeroVector;
+	FRotator PendingRotation = FRotator::ZeroRotator;
+	bool bHasPendingRotation = false;
+
+	// UDroneAvoidanceSubsystem 이 지난 프레임 끝에 구한 분리/회피 속도
+	FVector AvoidanceVelocity = FVector::ZeroVector;
+
+	// 조향을 받는 드론끼리 스윕에서 서로 무시하는 중인지와, 되돌릴 원래 오브젝트 채널 (UDroneAvoidanceSubsystem::SetDroneSweepsIgnored)
+	bool bAvoidanceSweepsIgnored = false;
+	TEnumAsByte<ECollisionChannel> AvoidanceRestoreObjectType = ECC_Pawn;
+
+	// 배치 모드에서 다음 배치 적분까지 누적된 추력 (ThrustInput * DeltaTime)
+	float PendingThrust = 0.f;
+
+	// 고정 스텝 상태
+	float FixedStepAccumulator = 0.f;
+	float InterpolationAlpha = 0.f;
+	float LastStepOffsetZ = 0.f;
+	FVector LastStepHorizontalOffset = FVector::ZeroVector;
+	float ThrustAxis = 0.f;
+	FVector2D PendingMoveInput = FVector2D::ZeroVector;
+
+	TArray<TWeakObjectPtr<USceneComponent>> InterpolatedComponents;
+	TArray<FVector> InterpolatedBaseLocations;
+
+	// UDroneMovementSubsystem 내 SoA 슬롯 (미등록 시 INDEX_NONE)
+	int32 BatchIndex = INDEX_NONE;
+
+	// 비동기 물리 상태 (미등록 시 0)
+	uint32 AsyncPhysicsId = 0;
+	float AsyncPhysicsOffsetZ = 0.f;
+	EDroneMovementMode AsyncPhysicsMode = EDroneMovementMode::Grounded;
+	bool bVelocityOverridePending = false;
+
 	// 지면 감지 설정
 	float GroundDetectionOffset = 10.f;
 	float SphereRadius = 0.f;
 
+	// 비동기 지면 감지 상태
+	FTraceHandle PendingGroundTrace;
+	FVector PendingGroundProbeLocation = FVector::ZeroVector;
+	float PendingGroundProbeLength = 0.f;
+	bool bHasAsyncGroundResult = false;
+	bool bAsyncGroundHit = false;
+	float AsyncGroundHitDistance = 0.f;
+	TWeakObjectPtr<UPrimitiveComponent> AsyncGroundHitComponent;
+
+	// 비행 기록 재생 중인 비동기 감지 드론: 월드가 틱하지 않으므로 요청 시 동기 트레이스하고 결과는 다음 프레임에 쓴다
+	bool bReplayGroundTraces = false;
+	bool bReplayGroundTracePending = false;
+	FHitResult ReplayGroundTraceHit;
+
+	// 예측 지면 감지 상태
+	float CachedGroundDistance = 0.f;
+	bool bGroundProbeHit = false;
+	FVector LastGroundProbeLocation = FVector::ZeroVector;
+	double NextGroundTraceTime = 0.0;
+
+	// 풀에 반납된 상태
+	bool bIsPooled = false;
+
+	// 슬립 상태
+	bool bIsSleeping = false;
+	double IdleStartTime = 0.0;
+	TWeakObjectPtr<UPrimitiveComponent> SupportingComponent;
+	TWeakObjectPtr<UPrimitiveComponent> SleepWatchedSupport;
+	FDelegateHandle SelfTransformHandle;
+	FDelegateHandle SupportTransformHandle;
+
+	// 네트워크 예측 상태: 클라이언트의 확인되지 않은 무브와 예측 결과
+	struct FDroneSavedMove
+	{
+		FDroneNetMove Move;
+		FDroneNetState PredictedState;
+	};
+	TArray<FDroneSavedMove> SavedMoves;
+
+	// 클라이언트: 다음 무브 번호 (조종 주체가 바뀌어도 계속 증가)
+	uint32 NextNetMoveId = 1;
+
+	// 서버: 마지막으로 처리한 클라이언트 무브 번호
+	uint32 LastServerMoveId = 0;
+
+	// 서버: 클라이언트 무브가 쓸 수 있는 남은 시간 (서버 경과 시간만큼 채워지고 MaxNetMoveTimeBudget 에서 멈춘다)
+	float NetMoveTimeBudget = 0.f;
+	double LastNetMoveBudgetTime = -1.0;
+
+	// 중요도 LOD 상태
+	float SimUpdateInterval = 0.f;
+	float SignificanceGroundTraceInterval = 0.f;
+	double LastSimUpdateTime = -1.0;
+	double LastGroundTraceTime = -1.0;
+	float SimCatchUpTime = 0.f;
+	bool bSimCatchUpPending = false;
+
+	// 가변 스텝 모드에서 이번 프레임을 나눈 스텝 수 (밀린 시간을 따라잡는 프레임만 1 보다 크다)
+	int32 VariableSubsteps = 1;
+
+	// 베이크된 지면 높이 캐시 (UDroneHeightFieldSubsystem 소유, 읽기 전용)
+	TSharedPtr<const FDroneHeightField> HeightField;
+
+	// 비행 기록기 (기록 중일 때만 ConsumeInputCommand/FinishSimFrame 이 입력/키프레임을 넘긴다)
+	UPROPERTY()
+	UDroneFlightRecorderSubsystem* FlightRecorder = nullptr;
+
+	// 이번 프레임 입력을 기록했으니 FinishSimFrame 에서 프레임 끝 기록도 해야 한다
+	bool bRecordingFrame = false;
+
+	UPROPERTY(EditAnywhere, Category = "Movement|Ground")
+	EDroneGroundTraceMode GroundTraceMode = EDroneGroundTraceMode::Sync;
+
+	// 베이크 파일이 있으면 정적 지형 위에서는 트레이스 대신 높이 캐시를 샘플링
+	UPROPERTY(EditAnywhere, Category = "Movement|Ground")
+	bool bUseBakedHeightField = true;
+
+	// 비행 중 수직 운동으로 착지 가능한 가장 빠른 시점까지 트레이스를 생략
+	UPROPERTY(EditAnywhere, Category = "Movement|Ground")
+	bool bUsePredictiveGroundTrace = true;
+
+	// 지면 거리 캐시용 프로브 길이
+	UPROPERTY(EditAnywhere, Category = "Movement|Ground", meta = (EditCondition = "bUsePredictiveGroundTrace", ClampMin = "0"))
+	float GroundProbeDistance = 5000.f;
+
+	// 예측과 무관하게 다시 프로브하기까지의 최대 간격 (움직이는 지형 대비)
+	UPROPERTY(EditAnywhere, Category = "Movement|Ground", meta = (EditCondition = "bUsePredictiveGroundTrace", ClampMin = "0"))
+	float MaxGroundTraceSkipTime = 1.f;
+
+	// 보수 모드: 마지막 프로브 지점에서 수평으로 일정 거리 이상 벗어나면 즉시 재프로브
+	UPROPERTY(EditAnywhere, Category = "Movement|Ground", meta = (EditCondition = "bUsePredictiveGroundTrace"))
+	bool bConservativeGroundProbe = true;
+
+	UPROPERTY(EditAnywhere, Category = "Movement|Ground", meta = (EditCondition = "bUsePredictiveGroundTrace && bConservativeGroundProbe", ClampMin = "0"))
+	float ReprobeLateralDistance = 200.f;
+
 	// 물리 설정
 	UPROPERTY(EditAnywhere, Category = "Movement|Gravity", meta=(ClampMax="0"))
 	float GravityZ = -980.f;
@@ -97,6 +480,58 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Movement")
 	float MoveSpeed = 800.f;
 
+	// 고정 스텝 설정: 프레임 레이트와 무관한 결정적 비행
+	UPROPERTY(EditAnywhere, Category = "Movement|Timestep")
+	bool bUseFixedTimestep = false;
+
+	// 가변 스텝 모드에서도 중요도 LOD 로 밀린 시간은 이 스텝 길이 이하로 나눠 적분한다
+	UPROPERTY(EditAnywhere, Category = "Movement|Timestep", meta = (ClampMin = "1", Units = "Hz"))
+	float FixedTimestepRate = 60.f;
+
+	UPROPERTY(EditAnywhere, Category = "Movement|Timestep", meta = (EditCondition = "bUseFixedTimestep", ClampMin = "1"))
+	int32 MaxSubsteps = 4;
+
+	// 틱 설정
+	UPROPERTY(EditAnywhere, Category = "Movement|Batching")
+	EDroneMovementTickMode TickMode = EDroneMovementTickMode::Batched;
+
+	// 네트워크 설정: 예측 결과가 서버와 이만큼 다르면 보정
+	UPROPERTY(EditAnywhere, Category = "Movement|Network", meta = (ClampMin = "0", Units = "cm"))
+	float NetLocationErrorTolerance = 3.f;
+
+	UPROPERTY(EditAnywhere, Category = "Movement|Network", meta = (ClampMin = "0"))
+	float NetZVelocityErrorTolerance = 10.f;
+
+	UPROPERTY(EditAnywhere, Category = "Movement|Network", meta = (ClampMin = "0", Units = "deg"))
+	float NetRotationErrorTolerance = 1.f;
+
+	// 확인을 기다리는 최대 무브 수 (넘치면 가장 오래된 무브부터 버린다)
+	UPROPERTY(EditAnywhere, Category = "Movement|Network", meta = (ClampMin = "1"))
+	int32 MaxSavedMoves = 96;
+
+	// 패킷 손실에 대비해 한 번에 함께 보내는 최근 무브 수
+	UPROPERTY(EditAnywhere, Category = "Movement|Network", meta = (ClampMin = "1", ClampMax = "8"))
+	int32 NetMoveRedundancy = 3;
+
+	// 시뮬레이티드 프록시 복제 정밀도 (피치/롤 범위는 비행 범위로 덮어쓴다)
+	UPROPERTY(EditAnywhere, Category = "Movement|Network")
+	FDroneStateQuantization StateQuantization;
+
+	// 무브 하나의 최대 시간 (클라이언트는 예측 전에, 서버는 적용 전에 같은 값으로 자른다)
+	UPROPERTY(EditAnywhere, Category = "Movement|Network", meta = (ClampMin = "0.01", Units = "s"))
+	float MaxNetMoveDeltaTime = 0.125f;
+
+	// 스피드핵 방지: 클라이언트 무브 시간 합이 서버 경과 시간을 이만큼 넘게 앞서면 초과분을 잘라낸다 (지터 흡수용 여유)
+	UPROPERTY(EditAnywhere, Category = "Movement|Network", meta = (ClampMin = "0.01", Units = "s"))
+	float MaxNetMoveTimeBudget = 0.25f;
+
+	// 슬립 설정: 착지 후 입력 없이 이 시간이 지나면 잠든다
+	UPROPERTY(EditAnywhere, Category = "Movement|Sleep")
+	bool bAllowSleep = true;
+
+	UPROPERTY(EditAnywhere, Category = "Movement|Sleep", meta = (EditCondition = "bAllowSleep", ClampMin = "0", Units = "s"))
+	float SleepDelay = 0.5f;
+
 public:
 	// 델리게이트
 	UPROPERTY(BlueprintAssignable)
@@ -104,4 +539,8 @@ public:
 
 	UPROPERTY(BlueprintAssignable)
 	FOnMovementModeChanged OnFlying;
+
+	// 지상에서 소비된 입력 명령의 피치 (드론은 기울지 않고 카메라만 움직인다)
+	UPROPERTY(BlueprintAssignable)
+	FOnGroundLookPitch OnGroundLookPitch;
 };
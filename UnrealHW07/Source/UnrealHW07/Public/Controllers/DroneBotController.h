@@ -0,0 +1,126 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/PlayerController.h"
+#include "DroneBotController.generated.h"
+
+class ADronePawn;
+class UHWInputComponent;
+class UInputAction;
+
+UENUM()
+enum class EDroneBotBehavior : uint8
+{
+	// 스폰 고도 근처에서 제자리 비행
+	Hover,
+	// 스폰 지점 주변 웨이포인트 순회
+	Patrol,
+	// 최대 추력으로 상승/하강 반복
+	ClimbDive,
+	// 짧게 이륙했다가 지면까지 내려와 착지 반복 (이동 모드 전환 부하)
+	LandingSpam
+};
+
+/**
+ * 부하 테스트용 봇 컨트롤러.
+ * 사람 플레이어와 같은 UDataAsset_InputConfig 입력 태그의 액션을 Enhanced Input 주입 API 로 넣고,
+ * 자체 입력 스택을 직접 처리해 폰의 Input_* 핸들러 → 이동 컴포넌트 입력 명령까지 실제 경로를 그대로 탄다.
+ * 로컬 플레이어가 없으므로 데디케이티드 서버에서도 돈다.
+ */
+UCLASS()
+class UNREALHW07_API ADroneBotController : public APlayerController
+{
+	GENERATED_BODY()
+
+public:
+	ADroneBotController();
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	void SetBehavior(EDroneBotBehavior InBehavior, int32 InSeed);
+	EDroneBotBehavior GetBehavior() const { return Behavior; }
+
+	// 지난 호출 이후 주입한 액션 수 (부하 테스트 집계용)
+	int32 ConsumeInjectedActionCount();
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void OnPossess(APawn* InPawn) override;
+	virtual void OnUnPossess() override;
+
+	// 입력 스택은 Tick 에서 직접 처리한다 (로컬 컨트롤러 경로와 이중 처리 방지)
+	virtual void ProcessPlayerInput(const float DeltaTime, const bool bGamePaused) override;
+
+private:
+	struct FBotInput
+	{
+		FVector2D Move = FVector2D::ZeroVector;
+		FVector2D Look = FVector2D::ZeroVector;
+		float Elevate = 0.f;
+		float Roll = 0.f;
+	};
+
+	// 폰의 입력 설정이 로드된 뒤 액션 바인딩
+	void BindBotInput();
+
+	FBotInput UpdateBehavior(float DeltaSeconds);
+	void InjectAction(UInputAction* Action, const FVector& Value);
+
+	// 고도 유지용 추력 (목표 고도 차와 수직 속도로 감쇠)
+	float GetHoldAltitudeThrust(float TargetZ) const;
+
+	UPROPERTY()
+	UHWInputComponent* BotInputComponent;
+
+	UPROPERTY()
+	ADronePawn* DronePawn;
+
+	UPROPERTY()
+	UInputAction* MoveAction;
+
+	UPROPERTY()
+	UInputAction* LookAction;
+
+	UPROPERTY()
+	UInputAction* ElevateAction;
+
+	UPROPERTY()
+	UInputAction* RollAction;
+
+	UPROPERTY()
+	TArray<UInputComponent*> BotInputStack;
+
+	UPROPERTY(EditAnywhere, Category = "Bot")
+	EDroneBotBehavior Behavior = EDroneBotBehavior::Hover;
+
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (Units = "cm"))
+	float HoverHeight = 800.f;
+
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (Units = "cm"))
+	float PatrolRadius = 5000.f;
+
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (Units = "s"))
+	float ClimbDivePeriod = 4.f;
+
+	// 착지 후 다시 이륙하기까지 대기 시간
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (Units = "s"))
+	float LandingSpamGroundTime = 0.5f;
+
+	// 이륙한 높이에서 이만큼 오르면 다시 하강
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (Units = "cm"))
+	float LandingSpamHopHeight = 100.f;
+
+	FRandomStream Random;
+	FVector HomeLocation = FVector::ZeroVector;
+	FVector PatrolTarget = FVector::ZeroVector;
+	float BehaviorTime = 0.f;
+	float GroundedTime = 0.f;
+	int32 InjectedActionCount = 0;
+
+	// LandingSpam 단계: 마지막 착지 높이 (이륙 기준) 와 하강 중인지
+	double LandingSpamTakeoffZ = 0.0;
+	bool bHasLandingSpamTakeoffZ = false;
+	bool bLandingSpamDescending = true;
+};
@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * 오프라인으로 베이크된 타일 높이맵 파일 헤더.
+ * 파일 = 헤더 + 타일 순서대로 (TileCells x TileCells) float 높이값. 타일 내부는 행 우선.
+ */
+struct FDroneHeightFieldHeader
+{
+	static constexpr uint32 ExpectedMagic = 0x46484444; // "DDHF"
+	static constexpr uint32 ExpectedVersion = 1;
+
+	uint32 Magic = ExpectedMagic;
+	uint32 Version = ExpectedVersion;
+	double OriginX = 0.0;
+	double OriginY = 0.0;
+	float CellSize = 100.f;
+	int32 TileCells = 64;
+	int32 NumTilesX = 0;
+	int32 NumTilesY = 0;
+};
+static_assert(sizeof(FDroneHeightFieldHeader) == 40, "FDroneHeightFieldHeader layout is part of the file format");
+
+/**
+ * 메모리 맵으로 읽는 지면 높이 캐시.
+ * 로드 이후에는 읽기 전용이므로 락 없이 어느 스레드에서나 샘플링할 수 있다.
+ */
+class UNREALHW07_API FDroneHeightField
+{
+public:
+	// 베이크 시 동적 지오메트리 / 지면 없음을 표시하는 값 (샘플링 시 트레이스로 대체)
+	static constexpr float InvalidHeight = -UE_MAX_FLT;
+
+	FDroneHeightField();
+	~FDroneHeightField();
+
+	bool Load(const FString& Filename);
+	bool IsValid() const { return Heights != nullptr; }
+
+	// 쌍선형 보간 높이. 범위 밖, 타일 경계, 무효 셀이면 false
+	bool SampleHeight(double X, double Y, float& OutHeight) const;
+
+	const FDroneHeightFieldHeader& GetHeader() const { return Header; }
+
+	// 맵 패키지 이름 → 베이크 파일 경로
+	static FString GetHeightFieldPath(const FString& MapPackageName);
+	static bool Save(const FString& Filename, const FDroneHeightFieldHeader& InHeader, const TArray<float>& TileMajorHeights);
+
+private:
+	float GetSample(int32 SampleX, int32 SampleY) const;
+
+	FDroneHeightFieldHeader Header;
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	const float* Heights = nullptr;
+};
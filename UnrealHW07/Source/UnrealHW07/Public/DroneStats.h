@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+/**
+ * 드론 계측: stat Drone (사이클/카운터), Unreal Insights CPU 스코프, CSV 프로파일러 Drone 카테고리.
+ * Shipping 빌드에서는 매크로가 모두 비어 계측 코드가 남지 않는다.
+ */
+#define DRONE_STATS !UE_BUILD_SHIPPING
+
+DECLARE_STATS_GROUP(TEXT("Drone"), STATGROUP_Drone, STATCAT_Advanced);
+
+/** Cycle Stats **/
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Movement Tick"), STAT_DroneMovementTick, STATGROUP_Drone, UNREALHW07_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Movement Batch Tick"), STAT_DroneMovementBatch, STATGROUP_Drone, UNREALHW07_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ground Trace"), STAT_DroneGroundTrace, STATGROUP_Drone, UNREALHW07_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Commit Move"), STAT_DroneCommitMove, STATGROUP_Drone, UNREALHW07_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Camera Interpolation"), STAT_DroneCameraInterp, STATGROUP_Drone, UNREALHW07_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Input Handlers"), STAT_DroneInput, STATGROUP_Drone, UNREALHW07_API);
+
+/** Frame Counters **/
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ground Traces"), STAT_DroneGroundTraces, STATGROUP_Drone, UNREALHW07_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Height Field Samples"), STAT_DroneHeightFieldSamples, STATGROUP_Drone, UNREALHW07_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skipped Ground Traces"), STAT_DroneSkippedTraces, STATGROUP_Drone, UNREALHW07_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sweeps"), STAT_DroneSweeps, STATGROUP_Drone, UNREALHW07_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mode Transitions"), STAT_DroneModeTransitions, STATGROUP_Drone, UNREALHW07_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Net Corrections"), STAT_DroneNetCorrections, STATGROUP_Drone, UNREALHW07_API);
+
+/** Persistent Counters **/
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Camera Interpolations"), STAT_DroneActiveCameraInterps, STATGROUP_Drone, UNREALHW07_API);
+
+#if DRONE_STATS
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(UNREALHW07_API, Drone);
+
+// 사이클 스탯 + CSV 타이밍
+#define DRONE_SCOPE_CYCLE_COUNTER(Stat, CsvStat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	CSV_SCOPED_TIMING_STAT(Drone, CsvStat)
+
+// 프레임 카운터 + CSV 누적값
+#define DRONE_INC_COUNTER(Stat, CsvStat) \
+	INC_DWORD_STAT(Stat); \
+	CSV_CUSTOM_STAT(Drone, CsvStat, 1, ECsvCustomStatOp::Accumulate)
+
+// 스탯 없이 Insights 타임라인에만 남기는 세부 구간
+#define DRONE_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE(Name)
+
+#else
+
+#define DRONE_SCOPE_CYCLE_COUNTER(Stat, CsvStat)
+#define DRONE_INC_COUNTER(Stat, CsvStat)
+#define DRONE_TRACE_SCOPE(Name)
+
+#endif
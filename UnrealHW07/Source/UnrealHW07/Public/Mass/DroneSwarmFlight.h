@@ -0,0 +1,31 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FDroneInputCommand;
+struct FDroneSwarmFlightFragment;
+struct FDroneSwarmFrameData;
+struct FDroneSwarmTransformFragment;
+class UDroneMovementComponent;
+
+/**
+ * 군집 드론 비행 스크립트와 엔티티 적분.
+ * UDroneSwarmFlightProcessor 는 엔티티를 직접 적분하고, UDroneSwarmSubsystem 은 조종되지 않는 승격 폰에 같은 스크립트를 입력 명령으로 넣어
+ * 승격/강등 경계에서 비행이 끊기지 않는다. 자동화 테스트가 두 경로의 결과를 비교한다.
+ */
+namespace DroneSwarmFlight
+{
+	// 드론마다 위상이 다른 추력 패턴 (플릿 성능 측정과 같은 형태)
+	FORCEINLINE float GetScriptThrust(double ScriptTime, float ScriptPhase)
+	{
+		return static_cast<float>(FMath::Sin(ScriptTime * 0.5 + ScriptPhase));
+	}
+
+	// 엔티티 한 대를 한 프레임 진행: 스크립트 추력 → 지면 판정/상태 전환 → 적분 (컴포넌트와 같은 고정/가변 스텝) → 수평 순항
+	UNREALHW07_API void Simulate(FDroneSwarmTransformFragment& Transform, FDroneSwarmFlightFragment& Flight, const FDroneSwarmFrameData& FrameData, float DeltaTime);
+
+	// Simulate 와 같은 스크립트를 이동 컴포넌트 입력 명령으로 채운다 (순항/선회는 비행 중일 때만 이동 축과 Yaw 입력으로)
+	UNREALHW07_API void FillInputCommand(FDroneInputCommand& Command, const UDroneMovementComponent& Movement, const FDroneSwarmFrameData& FrameData, float ScriptPhase, float DeltaTime);
+}
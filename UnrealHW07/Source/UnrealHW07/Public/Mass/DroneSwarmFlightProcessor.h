@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityQuery.h"
+#include "MassProcessor.h"
+#include "DroneSwarmFlightProcessor.generated.h"
+
+/**
+ * 군집 드론 비행 프로세서.
+ * 청크 단위로 병렬 처리하며, 엔티티마다 DroneSwarmFlight::Simulate (스크립트 추력 → 지면 판정/상태 전환 → DroneKinematics 고정 스텝 적분 → 수평 순항) 로 진행하고
+ * 렌더 트랜스폼과 승격 요청을 UDroneSwarmSubsystem 의 슬롯 배열에 쓴다 (슬롯이 엔티티마다 달라 락이 필요 없다).
+ */
+UCLASS()
+class UNREALHW07_API UDroneSwarmFlightProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UDroneSwarmFlightProcessor();
+
+protected:
+	// UMassProcessor 오버라이드
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery FlightQuery;
+};
@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "Components/Movement/DroneMovementComponent.h"
+#include "DroneSwarmFragments.generated.h"
+
+// 군집 드론 (액터 없이 Mass 엔티티로만 존재하는 드론)
+USTRUCT()
+struct FDroneSwarmTag : public FMassTag
+{
+	GENERATED_BODY()
+};
+
+// 위치와 방향 (군집 드론은 Pitch/Roll 없이 Yaw 만 쓴다)
+USTRUCT()
+struct FDroneSwarmTransformFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	FVector Location = FVector::ZeroVector;
+	float Yaw = 0.f;
+};
+
+// UDroneMovementComponent 와 같은 규칙으로 적분하는 비행 상태
+USTRUCT()
+struct FDroneSwarmFlightFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	float ZVelocity = 0.f;
+	float FixedStepAccumulator = 0.f;
+
+	// 드론마다 다른 추력/선회 패턴 위상
+	float ScriptPhase = 0.f;
+
+	EDroneMovementMode MovementMode = EDroneMovementMode::Grounded;
+};
+
+// UDroneSwarmSubsystem 의 인스턴스 슬롯 (ISM 인스턴스 인덱스와 같다)
+USTRUCT()
+struct FDroneSwarmInstanceFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	int32 InstanceIndex = INDEX_NONE;
+};
@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DroneRelevancyGrid.generated.h"
+
+/** 드론 공간 관련성 설정 (UDroneReplicationGraph 에서 Config 로 읽는다) */
+USTRUCT()
+struct FDroneRelevancySettings
+{
+	GENERATED_BODY()
+
+	// 3D 격자 셀 크기
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "100", Units = "cm"))
+	float CellSize = 10000.f;
+
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "100", Units = "cm"))
+	float CellHeight = 5000.f;
+
+	// 고도 0 기준 컬 거리 (착지 드론은 더 짧게)
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0", Units = "cm"))
+	float FlyingCullDistance = 20000.f;
+
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0", Units = "cm"))
+	float GroundedCullDistance = 8000.f;
+
+	// 드론과 시점 중 높은 쪽의 고도 1cm 당 늘어나는 컬 거리 (높이 있을수록 멀리서 보인다)
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0"))
+	float AltitudeCullScale = 2.f;
+
+	UPROPERTY(EditAnywhere, meta = (Units = "cm"))
+	float GroundReferenceZ = 0.f;
+
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0", Units = "cm"))
+	float MaxCullDistance = 60000.f;
+
+	// 거리별 복제 주기 (복제 프레임 단위): NearDistance 안 / FarDistance 안 / 그 밖
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0", Units = "cm"))
+	float NearDistance = 5000.f;
+
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0", Units = "cm"))
+	float FarDistance = 20000.f;
+
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "1"))
+	int32 NearPeriod = 1;
+
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "1"))
+	int32 MidPeriod = 2;
+
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "1"))
+	int32 FarPeriod = 4;
+
+	// 착지 드론은 주기를 이만큼 늘린다
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "1"))
+	int32 GroundedPeriodScale = 2;
+};
+
+/**
+ * 드론 3D 격자와 고도 인식 컬링 규칙.
+ * 엔진 복제 시스템에 의존하지 않으므로 리플리케이션 그래프 노드와 자동화 테스트가 같은 규칙을 쓴다.
+ * 시점마다 점유된 셀만 훑고, 셀 높이로 구한 최대 컬 거리 밖의 셀은 통째로 건너뛴다.
+ */
+class UNREALHW07_API FDroneRelevancyGrid
+{
+public:
+	struct FCell
+	{
+		FIntVector Coord;
+		FBox Bounds;
+		TArray<int32> Items;
+	};
+
+	explicit FDroneRelevancyGrid(const FDroneRelevancySettings& InSettings = FDroneRelevancySettings())
+		: Settings(InSettings)
+	{
+	}
+
+	void SetSettings(const FDroneRelevancySettings& InSettings) { Settings = InSettings; }
+	const FDroneRelevancySettings& GetSettings() const { return Settings; }
+
+	// 셀 배열은 재사용 (빈 셀 항목만 비운다)
+	void Reset();
+
+	// 항목을 셀에 넣고 셀 인덱스를 돌려준다
+	int32 Add(int32 Item, const FVector& Location);
+
+	const TArray<FCell>& GetCells() const { return Cells; }
+
+	// 시점에서 닿을 수 있는 셀인지 (셀 안에서 가장 높은 지점 기준 최대 컬 거리)
+	bool IsCellInRange(const FCell& Cell, const FVector& ViewLocation) const;
+
+	// 드론-시점 한 쌍의 컬 거리와 복제 주기
+	float GetCullDistance(const FVector& DroneLocation, bool bGrounded, const FVector& ViewLocation) const;
+	int32 GetReplicationPeriod(float Distance, bool bGrounded) const;
+
+private:
+	FIntVector GetCellCoord(const FVector& Location) const;
+
+	FDroneRelevancySettings Settings;
+	TArray<FCell> Cells;
+	TMap<FIntVector, int32> CellIndices;
+};
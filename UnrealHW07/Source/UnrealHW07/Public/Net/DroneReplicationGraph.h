@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "Net/DroneRelevancyGrid.h"
+#include "DroneReplicationGraph.generated.h"
+
+class UDroneMovementComponent;
+
+/**
+ * 드론 3D 격자 노드.
+ * 매 복제 프레임 드론 위치로 격자를 다시 만들고, 연결마다 닿는 셀 목록을 모은다.
+ * 셀 안 드론마다 고도 인식 컬 거리와 거리/착지 여부에 따른 복제 주기를 연결별 정보에 기록해
+ * 실제 컬링과 주기 적용은 리플리케이션 그래프 본체가 한다.
+ */
+UCLASS()
+class UNREALHW07_API UDroneReplicationGraphNode_Grid3D : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	UDroneReplicationGraphNode_Grid3D();
+
+	void SetSettings(const FDroneRelevancySettings& InSettings) { Grid.SetSettings(InSettings); }
+
+	// UReplicationGraphNode 오버라이드
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+	virtual void PrepareForReplication() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+private:
+	struct FTrackedDrone
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<UDroneMovementComponent> Movement;
+
+		// 액터가 이미 파괴된 뒤에도 인덱스 맵에서 지울 수 있도록 키를 따로 둔다
+		TObjectKey<AActor> Key;
+	};
+
+	// 마지막 항목을 빈 자리로 옮기고 옮겨진 항목의 인덱스를 갱신한다
+	void RemoveDroneAt(int32 Index);
+
+	TArray<FTrackedDrone> Drones;
+
+	// 액터 -> Drones 인덱스 (제거 알림을 선형 탐색 없이 처리)
+	TMap<TObjectKey<AActor>, int32> DroneIndices;
+
+	// 이번 프레임 드론별 위치/착지 여부 (Drones 와 같은 인덱스)
+	TArray<FVector> Locations;
+	TArray<bool> GroundedFlags;
+
+	FDroneRelevancyGrid Grid;
+
+	// 셀마다 복제 목록 (Grid 셀과 같은 인덱스, 프레임 사이 메모리 재사용)
+	TArray<FActorRepListRefView> CellLists;
+};
+
+/** 연결마다 항상 관련: 그 연결의 컨트롤러, 조종 중인 폰, 뷰 타깃 */
+UCLASS()
+class UNREALHW07_API UDroneReplicationGraphNode_AlwaysRelevant_ForConnection : public UReplicationGraphNode_AlwaysRelevant_ForConnection
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+};
+
+/**
+ * 드론용 리플리케이션 그래프.
+ * 드론은 3D 격자 노드가, 조종 중인 폰은 연결별 노드가, 나머지(게임 스테이트 등)는 전역 항상 관련 노드가 맡는다.
+ * DefaultEngine.ini 의 IpNetDriver ReplicationDriverClassName 으로 활성화한다.
+ */
+UCLASS(Transient, Config = Game)
+class UNREALHW07_API UDroneReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	// UReplicationGraph 오버라이드
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+private:
+	// 소유자에게만 관련된 액터는 연결별 노드가 뷰어/폰으로 모으므로 전역 노드에 넣지 않는다
+	static bool IsOwnerOnly(const AActor* Actor);
+
+	UPROPERTY(Config, EditAnywhere, Category = "Relevancy")
+	FDroneRelevancySettings RelevancySettings;
+
+	UPROPERTY()
+	UDroneReplicationGraphNode_Grid3D* DroneGridNode;
+
+	UPROPERTY()
+	UReplicationGraphNode_ActorList* AlwaysRelevantNode;
+};
@@ -0,0 +1,140 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "DroneStateCodec.generated.h"
+
+enum class EDroneMovementMode : uint8;
+
+/**
+ * 드론 상태 양자화 설정. 보내는 쪽과 받는 쪽이 같은 값을 써야 한다.
+ * 위치/속도는 정밀도 단위 정수, 회전은 범위를 2^Bits 단계로 나눈다.
+ */
+USTRUCT()
+struct UNREALHW07_API FDroneStateQuantization
+{
+	GENERATED_BODY()
+
+	// 위치 정밀도
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0.01", Units = "cm"))
+	float PositionPrecision = 0.25f;
+
+	// 원점 기준 표현 가능한 최대 좌표 (밖이면 경계로 클램프)
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "100", Units = "cm"))
+	float PositionExtent = 1048576.f;
+
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "4", ClampMax = "16"))
+	int32 YawBits = 14;
+
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "4", ClampMax = "16"))
+	int32 PitchRollBits = 12;
+
+	// 피치/롤 표현 범위 (비행 피치/롤 범위로 좁히면 같은 비트로 더 정밀)
+	UPROPERTY(EditAnywhere)
+	FFloatInterval PitchRange = FFloatInterval(-90.f, 90.f);
+
+	UPROPERTY(EditAnywhere)
+	FFloatInterval RollRange = FFloatInterval(-180.f, 180.f);
+
+	// 수직 속도 정밀도와 범위
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0.01", Units = "cm/s"))
+	float VelocityPrecision = 1.f;
+
+	UPROPERTY(EditAnywhere)
+	FFloatInterval VelocityRange = FFloatInterval(-2048.f, 2048.f);
+
+	int32 GetPositionBits() const;
+	int32 GetVelocityBits() const;
+};
+
+/** 양자화된 드론 상태 (필드마다 고정 비트 수의 부호 없는 정수) */
+struct FDroneQuantizedState
+{
+	enum EField : uint8
+	{
+		X,
+		Y,
+		Z,
+		Yaw,
+		Pitch,
+		Roll,
+		ZVelocity,
+		MovementMode,
+		NumFields
+	};
+
+	uint32 Values[NumFields] = {};
+
+	bool operator==(const FDroneQuantizedState& Other) const
+	{
+		return FMemory::Memcmp(Values, Other.Values, sizeof(Values)) == 0;
+	}
+};
+
+/**
+ * 드론 상태 비트 패킹 코덱 (네트워크/디스크 공용).
+ * 아카이브는 비트 단위 아카이브여야 한다 (FBitWriter/FBitReader, NetSerialize 의 아카이브).
+ * - Full: 필드마다 고정 비트
+ * - Delta: 기준 상태 대비 필드마다 변경 비트 1개 + 바뀐 필드만 가변 길이 차분 (필드 비트 수 기준 순환 차분)
+ */
+namespace DroneStateCodec
+{
+	UNREALHW07_API int32 GetFieldBits(const FDroneStateQuantization& Settings, int32 Field);
+
+	UNREALHW07_API FDroneQuantizedState Quantize(const FVector& Location, const FRotator& Rotation, float ZVelocity, EDroneMovementMode MovementMode, const FDroneStateQuantization& Settings);
+	UNREALHW07_API void Dequantize(const FDroneQuantizedState& State, const FDroneStateQuantization& Settings, FVector& OutLocation, FRotator& OutRotation, float& OutZVelocity, EDroneMovementMode& OutMovementMode);
+
+	UNREALHW07_API void WriteFull(FArchive& Ar, const FDroneQuantizedState& State, const FDroneStateQuantization& Settings);
+	UNREALHW07_API void ReadFull(FArchive& Ar, FDroneQuantizedState& OutState, const FDroneStateQuantization& Settings);
+
+	UNREALHW07_API void WriteDelta(FArchive& Ar, const FDroneQuantizedState& State, const FDroneQuantizedState& Baseline, const FDroneStateQuantization& Settings);
+	UNREALHW07_API void ReadDelta(FArchive& Ar, FDroneQuantizedState& OutState, const FDroneQuantizedState& Baseline, const FDroneStateQuantization& Settings);
+}
+
+/**
+ * 시뮬레이티드 프록시로 복제하는 드론 상태.
+ * 커스텀 델타 직렬화로 연결마다 마지막으로 확인된(손실 시 되돌려진) 기준 상태 대비 차분만 보낸다.
+ * 받는 쪽은 최근 받은 상태를 식별자로 보관해 기준을 찾고, 기준이 없으면 그 갱신을 건너뛴다.
+ */
+USTRUCT()
+struct UNREALHW07_API FDroneReplicatedState
+{
+	GENERATED_BODY()
+
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	float ZVelocity = 0.f;
+	EDroneMovementMode MovementMode{};
+
+	// 양쪽 컴포넌트가 같은 값으로 설정 (복제하지 않음)
+	FDroneStateQuantization Quantization;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+
+private:
+	static constexpr int32 MaxReceivedHistory = 64;
+
+	struct FReceivedState
+	{
+		uint16 StateId = 0;
+		FDroneQuantizedState State;
+	};
+
+	// 보내는 쪽: 다음 상태 식별자 (0 은 쓰지 않음)
+	uint16 NextStateId = 1;
+
+	// 받는 쪽: 최근 받은 상태 링 버퍼
+	TArray<FReceivedState> ReceivedHistory;
+	int32 NextHistoryIndex = 0;
+};
+
+template<>
+struct TStructOpsTypeTraits<FDroneReplicatedState> : public TStructOpsTypeTraitsBase2<FDroneReplicatedState>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
@@ -10,9 +10,12 @@ class UDroneCameraComponent;
 class UDroneMovementComponent;
 struct FInputActionValue;
 class UDataAsset_InputConfig;
+class UHWInputComponent;
 class UCameraComponent;
 class USpringArmComponent;
 class USphereComponent;
+class USkeletalMesh;
+struct FStreamableHandle;
 
 UENUM(BlueprintType)
 enum class EDroneMoveState : uint8
@@ -28,11 +31,35 @@ class UNREALHW07_API ADronePawn : public APawn
 
 public:
 	// Sets default values for this pawn's properties
-	ADronePawn();
+	ADronePawn(const FObjectInitializer& ObjectInitializer);
+
+	// 데디케이티드 서버에서 만들지 않는 선택 서브오브젝트 이름
+	static FName MeshComponentName;
+	static FName CameraBoomComponentName;
+	static FName FollowCameraComponentName;
+	static FName DroneCameraComponentName;
+
+	// 입력 태그별 액션을 Input_* 핸들러에 바인딩 (플레이어 입력 컴포넌트와 봇 컨트롤러가 같이 쓴다)
+	void BindInputActions(UHWInputComponent* HWInputComponent);
+
+	// 입력 설정은 비동기로 로드되므로 로드 전에는 null
+	const UDataAsset_InputConfig* GetInputConfig() const { return LoadedInputConfig; }
+	UDroneMovementComponent* GetDroneMovement() const { return DroneMovement; }
+
+	// 폰 데이터 (입력 설정, 메시) 로드가 끝나면 호출. 이미 끝났으면 바로 호출
+	bool IsPawnDataLoaded() const { return bPawnDataLoaded; }
+	void CallOrRegister_OnPawnDataLoaded(FSimpleDelegate&& Delegate);
+
+	// 풀링 (UDronePoolSubsystem): 반납하면 조종을 풀고 숨긴 채 멈추며, 재사용 시 이동/카메라 상태를 스폰 직후로 되돌린다
+	void ReleaseToPool();
+	void ActivateFromPool(const FVector& Location, const FRotator& Rotation);
 
 protected:
 	virtual void SetupPlayerInputComponent(UInputComponent* PlayerInputComponent) override;
+	virtual void PostInitializeComponents() override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void NotifyControllerChanged() override;
 
 	void Input_Move(const FInputActionValue& InputActionValue);
 	void Input_Look(const FInputActionValue& InputActionValue);
@@ -42,16 +69,29 @@ protected:
 	void Input_Roll(const FInputActionValue& InputActionValue);
 
 private:
+	static const FObjectInitializer& SkipCosmeticSubobjectsOnServer(const FObjectInitializer& ObjectInitializer);
+
+	// 소프트 참조한 폰 데이터를 스트리머블 매니저로 비동기 로드
+	void RequestPawnDataLoad();
+	void HandlePawnDataLoaded();
+
+	// 매핑 컨텍스트 추가 + 액션 바인딩 (입력 설정 로드 후)
+	void SetupDroneInput(UHWInputComponent* HWInputComponent);
+
 	UFUNCTION()
 	void HandleLanded();
 
 	UFUNCTION()
 	void HandleFlying();
+
+	UFUNCTION()
+	void HandleGroundLookPitch(float PitchDelta);
 	
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Components")
 	USphereComponent* SphereRoot;
 
+	// Mesh/CameraBoom/FollowCamera/DroneCameraInterp 는 선택 서브오브젝트라 데디케이티드 서버에서는 null 이다
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Components")
 	USkeletalMeshComponent* Mesh;
 
@@ -67,8 +107,13 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Components")
 	UDroneCameraComponent* DroneCameraInterp;
 
+	// 폰 데이터는 소프트 참조: 클래스를 로드해도 쓰지 않는 변형의 에셋은 메모리에 올라오지 않는다
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PawnData")
+	TSoftObjectPtr<UDataAsset_InputConfig> InputConfigDataAsset;
+
+	// 비어 있으면 Mesh 컴포넌트에 지정된 메시를 그대로 쓴다
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PawnData")
-	UDataAsset_InputConfig* InputConfigDataAsset;
+	TSoftObjectPtr<USkeletalMesh> DroneMeshAsset;
 
 	UPROPERTY(EditAnywhere, Category = "Movement")
 	float LookSensitivity = 1.f;
@@ -96,4 +141,20 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Movement|Flight", meta = (ClampMin = "-45", ClampMax = "45"))
 	FFloatInterval FlyingRollRange = FFloatInterval(-30, 30.f);
 
+private:
+	TSharedPtr<FStreamableHandle> PawnDataHandle;
+	bool bPawnDataLoaded = false;
+	FSimpleMulticastDelegate OnPawnDataLoaded;
+
+	// 로드 전에 빙의되면 바인딩을 로드 완료 시점으로 미룬다
+	UPROPERTY()
+	UHWInputComponent* PendingInputComponent = nullptr;
+
+	// 로드가 끝난 폰 데이터. 이미 메모리에 있던 에셋은 핸들 없이 쓰므로, 핸들을 가진 다른 드론이 사라져도 GC 되지 않게 강참조로 잡는다
+	UPROPERTY(Transient)
+	UDataAsset_InputConfig* LoadedInputConfig = nullptr;
+
+	UPROPERTY(Transient)
+	USkeletalMesh* LoadedDroneMesh = nullptr;
+
 };
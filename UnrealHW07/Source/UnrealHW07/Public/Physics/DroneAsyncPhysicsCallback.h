@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Components/Movement/DroneMovementComponent.h"
+
+class FDroneHeightField;
+
+// 게임 스레드 → 물리 스레드 (드론 하나)
+struct FDroneAsyncPhysicsDroneInput
+{
+	uint32 DroneId = 0;
+	FVector Location = FVector::ZeroVector;
+
+	// 게임 스레드 프로브로 추정한 지면 높이 (높이 캐시가 있으면 물리 스레드에서 다시 샘플링)
+	double GroundZ = 0.0;
+	bool bHasGround = false;
+
+	bool bElevating = false;
+	float ThrustAxis = 0.f;
+
+	// 게임 스레드에서 속도를 직접 바꾼 경우 (SetVerticalVelocity 등)
+	bool bOverrideVelocity = false;
+	float OverrideVelocity = 0.f;
+
+	// 물리 스레드 상태를 처음 만들 때만 사용
+	EDroneMovementMode InitialMovementMode = EDroneMovementMode::Grounded;
+
+	float GroundDetectionLength = 0.f;
+	float GravityZ = 0.f;
+	float MaxFallingSpeed = 0.f;
+	float MaxAscendingSpeed = 0.f;
+	float ThrustAccelZ = 0.f;
+};
+
+// 물리 스레드 → 게임 스레드 (드론 하나, 물리 스텝 하나)
+struct FDroneAsyncPhysicsDroneOutput
+{
+	uint32 DroneId = 0;
+	float ZVelocity = 0.f;
+	float OffsetZ = 0.f;
+	EDroneMovementMode MovementMode = EDroneMovementMode::Grounded;
+};
+
+struct FDroneAsyncPhysicsInput : public Chaos::FSimCallbackInput
+{
+	TArray<FDroneAsyncPhysicsDroneInput> Drones;
+	TArray<uint32> RemovedDroneIds;
+	TSharedPtr<const FDroneHeightField> HeightField;
+
+	void Reset()
+	{
+		Drones.Reset();
+		RemovedDroneIds.Reset();
+		HeightField.Reset();
+	}
+};
+
+struct FDroneAsyncPhysicsOutput : public Chaos::FSimCallbackOutput
+{
+	TArray<FDroneAsyncPhysicsDroneOutput> Drones;
+
+	void Reset()
+	{
+		Drones.Reset();
+	}
+};
+
+/**
+ * 비동기 물리 스레드에서 드론의 수직 운동, 추력, 지면 접촉을 처리하는 Chaos 콜백.
+ * 입력은 게임 스레드 프레임마다 한 번 들어오고, 물리 스텝마다 결과를 내보낸다.
+ */
+class UNREALHW07_API FDroneAsyncPhysicsCallback : public Chaos::TSimCallbackObject<FDroneAsyncPhysicsInput, FDroneAsyncPhysicsOutput>
+{
+protected:
+	virtual void OnPreSimulate_Internal() override;
+
+private:
+	struct FDroneState
+	{
+		float ZVelocity = 0.f;
+		double OffsetSinceInput = 0.0;
+		EDroneMovementMode MovementMode = EDroneMovementMode::Grounded;
+	};
+
+	float StepDrone(const FDroneAsyncPhysicsDroneInput& Drone, FDroneState& State, float DeltaTime) const;
+
+	// 물리 스레드 전용 상태
+	TMap<uint32, FDroneState> States;
+	TArray<FDroneAsyncPhysicsDroneInput> LatestDrones;
+	TSharedPtr<const FDroneHeightField> HeightField;
+};
@@ -0,0 +1,87 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Physics/DroneSpatialHash.h"
+
+/**
+ * 드론 간 분리/예측 회피 조향의 순수 커널.
+ * 다른 드론에 대한 스윕 대신, 이웃 위치/속도만으로 밀어내는 속도를 해석적으로 구한다.
+ */
+struct FDroneAvoidanceParams
+{
+	// 이웃 질의 반경 (공간 해시 셀 크기와 같게 둔다)
+	float NeighborRadius = 600.f;
+
+	// 분리: 이 거리 안의 이웃에게서 (1 - d/R) 비율로 멀어진다
+	float SeparationRadius = 250.f;
+	float SeparationStrength = 400.f;
+
+	// 예측 회피: LookAheadTime 안에 최근접 거리가 AvoidanceRadius 보다 가까워지면 미리 비켜난다
+	float AvoidanceRadius = 150.f;
+	float LookAheadTime = 1.f;
+	float AvoidanceStrength = 300.f;
+
+	// 합산한 조향 속도 상한
+	float MaxSpeed = 600.f;
+};
+
+namespace DroneAvoidance
+{
+	// 이웃 한 대에 대한 조향 속도 (Offset = 자신 - 이웃 위치, RelativeVelocity = 자신 - 이웃 속도)
+	FORCEINLINE FVector ComputePairSteering(const FVector& Offset, double DistanceSq, const FVector& RelativeVelocity, const FDroneAvoidanceParams& Params)
+	{
+		FVector Steering = FVector::ZeroVector;
+
+		// 분리: 완전히 겹친 경우는 방향이 없으므로 예측 회피에 맡긴다
+		if (DistanceSq < FMath::Square(Params.SeparationRadius) && DistanceSq > UE_KINDA_SMALL_NUMBER)
+		{
+			const double Distance = FMath::Sqrt(DistanceSq);
+			Steering += Offset * (Params.SeparationStrength * (1.0 - Distance / Params.SeparationRadius) / Distance);
+		}
+
+		// 예측 회피: 상대 운동의 최근접 시각 t = -(P·V)/(V·V)
+		const double RelativeSpeedSq = RelativeVelocity.SizeSquared();
+		if (RelativeSpeedSq > UE_KINDA_SMALL_NUMBER)
+		{
+			const double TimeToClosest = -FVector::DotProduct(Offset, RelativeVelocity) / RelativeSpeedSq;
+			if (TimeToClosest > 0.0 && TimeToClosest < Params.LookAheadTime)
+			{
+				FVector ClosestOffset = Offset + RelativeVelocity * TimeToClosest;
+				const double ClosestDistance = ClosestOffset.Size();
+				if (ClosestDistance < Params.AvoidanceRadius)
+				{
+					// 정면 충돌이면 진행 방향의 수평 직각으로 비킨다 (상대 속도가 반대이므로 두 드론이 서로 반대로 비킨다)
+					if (ClosestDistance < UE_KINDA_SMALL_NUMBER)
+					{
+						ClosestOffset = FVector::CrossProduct(RelativeVelocity, FVector::UpVector);
+					}
+
+					const double Urgency = (1.0 - TimeToClosest / Params.LookAheadTime) * (1.0 - ClosestDistance / Params.AvoidanceRadius);
+					Steering += ClosestOffset.GetSafeNormal() * (Params.AvoidanceStrength * Urgency);
+				}
+			}
+		}
+
+		return Steering;
+	}
+
+	// Index 번 드론의 조향 속도: 공간 해시로 NeighborRadius 안의 이웃만 본다
+	inline FVector ComputeSteering(const FDroneSpatialHash& Hash, int32 Index, TConstArrayView<FVector> Positions, TConstArrayView<FVector> Velocities, const FDroneAvoidanceParams& Params)
+	{
+		const FVector& Position = Positions[Index];
+		const FVector& Velocity = Velocities[Index];
+
+		FVector Steering = FVector::ZeroVector;
+		Hash.ForEachNeighbor(Position, Params.NeighborRadius, [&](int32 Other, const FVector& OtherPosition, double DistanceSq)
+		{
+			if (Other != Index)
+			{
+				Steering += ComputePairSteering(Position - OtherPosition, DistanceSq, Velocity - Velocities[Other], Params);
+			}
+		});
+
+		return Steering.GetClampedToMaxSize(Params.MaxSpeed);
+	}
+}
@@ -0,0 +1,190 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+/**
+ * 드론 수직 운동/상태 전환/회전 클램프의 순수 커널.
+ * UObject, UWorld 에 의존하지 않으므로 컴포넌트, 배치 서브시스템, 비동기 물리 콜백, 자동화 테스트가 모두 같은 규칙을 공유한다.
+ */
+struct FDroneKinematicsParams
+{
+	float GravityZ = -980.f;
+	float MaxFallingSpeed = -1000.f;
+	float MaxAscendingSpeed = 400.f;
+	float ThrustAccelZ = 1000.f;
+	float VelocityResetThreshold = -50.f;
+};
+
+struct FDroneKinematicsState
+{
+	float ZVelocity = 0.f;
+	bool bFlying = false;
+};
+
+// 지면 판정 결과에 따른 상태 전환
+enum class EDroneKinematicsTransition : uint8
+{
+	None,
+	Land,
+	TakeOff
+};
+
+// SoA 배치 적분용 포인터 묶음 (모든 배열은 같은 길이)
+struct FDroneKinematicsBatchView
+{
+	float* ZVelocity;
+	float* DeltaZ;
+	float* LastStepOffsetZ;
+	const float* FlyingMask;
+	const float* PendingThrust;
+	const float* StepDeltaTime;
+	const float* NumSteps;
+	const float* GravityZ;
+	const float* MaxFallingSpeed;
+	const float* MaxAscendingSpeed;
+	const float* ThrustAccelZ;
+};
+
+namespace DroneKinematics
+{
+	// 추력 (ThrustImpulse = 입력 축 x 시간), 범위 클램프
+	FORCEINLINE void ApplyThrust(float& ZVelocity, float ThrustImpulse, const FDroneKinematicsParams& Params)
+	{
+		ZVelocity = FMath::Clamp(ZVelocity + ThrustImpulse * Params.ThrustAccelZ, Params.MaxFallingSpeed, Params.MaxAscendingSpeed);
+	}
+
+	// 뉴턴의 운동 법칙 적용
+	FORCEINLINE void ApplyGravity(float& ZVelocity, float DeltaTime, const FDroneKinematicsParams& Params)
+	{
+		ZVelocity = FMath::Max(ZVelocity + Params.GravityZ * DeltaTime, Params.MaxFallingSpeed);
+	}
+
+	// 하강 중 상승 입력이 들어오면 하강 속도를 임계값까지 줄인다. 바뀌었으면 true
+	FORCEINLINE bool ApplyVelocityReset(float& ZVelocity, float InputValue, const FDroneKinematicsParams& Params)
+	{
+		if (ZVelocity < 0.f && InputValue > 0.f)
+		{
+			ZVelocity = FMath::Max(ZVelocity, Params.VelocityResetThreshold);
+			return true;
+		}
+		return false;
+	}
+
+	// 착지 판정 + 상승 입력 → 상태 전환 규칙
+	FORCEINLINE EDroneKinematicsTransition ResolveTransition(bool bFlying, bool bOnLanded, bool bElevating)
+	{
+		if (bOnLanded && bFlying && !bElevating)
+		{
+			return EDroneKinematicsTransition::Land;
+		}
+		if ((!bOnLanded || bElevating) && !bFlying)
+		{
+			return EDroneKinematicsTransition::TakeOff;
+		}
+		return EDroneKinematicsTransition::None;
+	}
+
+	// 비행 회전: Yaw 는 누적, Pitch/Roll 은 범위 클램프
+	FORCEINLINE FRotator ClampFlightRotation(const FRotator& Current, float YawDelta, float PitchDelta, float RollDelta, const FFloatInterval& PitchRange, const FFloatInterval& RollRange)
+	{
+		return FRotator(
+			FMath::Clamp(Current.Pitch + PitchDelta, PitchRange.Min, PitchRange.Max),
+			Current.Yaw + YawDelta,
+			FMath::Clamp(Current.Roll + RollDelta, RollRange.Min, RollRange.Max));
+	}
+
+	// 한 스텝: 반암시적 오일러 (속도를 먼저 갱신하고 새 속도로 위치를 적분). 수직 이동량 반환
+	FORCEINLINE float Step(FDroneKinematicsState& State, float StepThrust, float StepDeltaTime, const FDroneKinematicsParams& Params)
+	{
+		if (StepThrust != 0.f)
+		{
+			ApplyThrust(State.ZVelocity, StepThrust, Params);
+		}
+
+		if (!State.bFlying)
+		{
+			return 0.f;
+		}
+
+		ApplyGravity(State.ZVelocity, StepDeltaTime, Params);
+		return State.ZVelocity * StepDeltaTime;
+	}
+
+	// 여러 스텝. 마지막 스텝 이동량은 렌더 보간용
+	inline float Simulate(FDroneKinematicsState& State, int32 NumSteps, float StepThrust, float StepDeltaTime, const FDroneKinematicsParams& Params, float& OutLastStepOffsetZ)
+	{
+		float TotalOffsetZ = 0.f;
+		for (int32 StepIndex = 0; StepIndex < NumSteps; ++StepIndex)
+		{
+			OutLastStepOffsetZ = Step(State, StepThrust, StepDeltaTime, Params);
+			TotalOffsetZ += OutLastStepOffsetZ;
+		}
+		return TotalOffsetZ;
+	}
+
+	// Step 과 동일한 규칙을 SoA [Begin, End) 구간에 적용 (4개씩 벡터 루프 + 스칼라 나머지, 드론별 스텝 수 마스킹)
+	inline void IntegrateBatch(const FDroneKinematicsBatchView& View, int32 Begin, int32 End, int32 MaxSteps)
+	{
+		const VectorRegister4Float Zero = VectorZeroFloat();
+
+		int32 Index = Begin;
+		for (; Index + 4 <= End; Index += 4)
+		{
+			VectorRegister4Float Velocity = VectorLoad(View.ZVelocity + Index);
+			VectorRegister4Float LastOffset = VectorLoad(View.LastStepOffsetZ + Index);
+			VectorRegister4Float TotalOffset = Zero;
+
+			const VectorRegister4Float Thrust = VectorLoad(View.PendingThrust + Index);
+			const VectorRegister4Float Dt = VectorLoad(View.StepDeltaTime + Index);
+			const VectorRegister4Float Steps = VectorLoad(View.NumSteps + Index);
+			const VectorRegister4Float MinSpeed = VectorLoad(View.MaxFallingSpeed + Index);
+			const VectorRegister4Float MaxSpeed = VectorLoad(View.MaxAscendingSpeed + Index);
+			const VectorRegister4Float Gravity = VectorLoad(View.GravityZ + Index);
+			const VectorRegister4Float ThrustAccel = VectorLoad(View.ThrustAccelZ + Index);
+			const VectorRegister4Float HasThrust = VectorCompareNE(Thrust, Zero);
+			const VectorRegister4Float IsFlying = VectorCompareGT(VectorLoad(View.FlyingMask + Index), Zero);
+
+			for (int32 StepIndex = 0; StepIndex < MaxSteps; ++StepIndex)
+			{
+				const VectorRegister4Float Active = VectorCompareGT(Steps, VectorSetFloat1(static_cast<float>(StepIndex)));
+
+				// 추력: 입력이 있을 때만 가속 후 클램프
+				const VectorRegister4Float Thrusted = VectorMin(VectorMax(VectorMultiplyAdd(Thrust, ThrustAccel, Velocity), MinSpeed), MaxSpeed);
+				Velocity = VectorSelect(VectorBitwiseAnd(Active, HasThrust), Thrusted, Velocity);
+
+				// 중력 후 새 속도로 위치 적분, 비행 중일 때만
+				const VectorRegister4Float Falling = VectorBitwiseAnd(Active, IsFlying);
+				const VectorRegister4Float Fallen = VectorMax(VectorMultiplyAdd(Gravity, Dt, Velocity), MinSpeed);
+				Velocity = VectorSelect(Falling, Fallen, Velocity);
+
+				const VectorRegister4Float StepOffset = VectorSelect(Falling, VectorMultiply(Velocity, Dt), Zero);
+				TotalOffset = VectorAdd(TotalOffset, StepOffset);
+				LastOffset = VectorSelect(Active, StepOffset, LastOffset);
+			}
+
+			VectorStore(Velocity, View.ZVelocity + Index);
+			VectorStore(TotalOffset, View.DeltaZ + Index);
+			VectorStore(LastOffset, View.LastStepOffsetZ + Index);
+		}
+
+		for (; Index < End; ++Index)
+		{
+			FDroneKinematicsParams Params;
+			Params.GravityZ = View.GravityZ[Index];
+			Params.MaxFallingSpeed = View.MaxFallingSpeed[Index];
+			Params.MaxAscendingSpeed = View.MaxAscendingSpeed[Index];
+			Params.ThrustAccelZ = View.ThrustAccelZ[Index];
+
+			FDroneKinematicsState State;
+			State.ZVelocity = View.ZVelocity[Index];
+			State.bFlying = View.FlyingMask[Index] > 0.f;
+
+			const int32 Steps = static_cast<int32>(View.NumSteps[Index]);
+			View.DeltaZ[Index] = Simulate(State, Steps, View.PendingThrust[Index], View.StepDeltaTime[Index], Params, View.LastStepOffsetZ[Index]);
+			View.ZVelocity[Index] = State.ZVelocity;
+		}
+	}
+}
@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 드론 위치의 균일 공간 해시.
+ * 셀 좌표를 2의 거듭제곱 크기 버킷 테이블로 해시하고, 카운팅 정렬로 같은 버킷의 드론을 연속된 배열에 모은다.
+ * 이웃 질의는 질의 구를 덮는 셀의 버킷만 순서대로 훑으므로 O(n²) 전수 비교 없이 캐시 친화적으로 동작한다.
+ * UObject, UWorld 에 의존하지 않으므로 회피 서브시스템과 자동화 테스트가 같은 구조를 쓴다.
+ */
+class UNREALHW07_API FDroneSpatialHash
+{
+public:
+	// 매 프레임 다시 만든다 (버킷 키 계산은 병렬, 배열은 재사용). CellSize 는 주 질의 반경과 같게 두면 질의당 27 셀
+	void Build(TConstArrayView<FVector> Positions, float InCellSize);
+
+	void Reset();
+
+	int32 Num() const { return SortedItems.Num(); }
+
+	// Radius 안의 모든 항목에 대해 Func(Item, Position, DistanceSq) 호출 (질의 위치의 항목 자신도 포함)
+	template <typename FuncType>
+	void ForEachNeighbor(const FVector& Location, float Radius, FuncType&& Func) const
+	{
+		if (SortedItems.IsEmpty())
+		{
+			return;
+		}
+
+		const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+		const FIntVector MinCell = GetCellCoord(Location - FVector(Radius));
+		const FIntVector MaxCell = GetCellCoord(Location + FVector(Radius));
+
+		// 서로 다른 셀이 같은 버킷으로 해시되면 한 번만 훑는다
+		TArray<uint32, TInlineAllocator<27>> VisitedBuckets;
+
+		for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+				{
+					const uint32 Bucket = HashCell(X, Y, Z);
+					const int32 Begin = BucketStart[Bucket];
+					const int32 End = BucketStart[Bucket + 1];
+					if (Begin == End || VisitedBuckets.Contains(Bucket))
+					{
+						continue;
+					}
+					VisitedBuckets.Add(Bucket);
+
+					// 해시 충돌로 섞인 다른 셀의 항목은 거리 검사에서 걸러진다
+					for (int32 SortedIndex = Begin; SortedIndex < End; ++SortedIndex)
+					{
+						const FVector& Position = SortedPositions[SortedIndex];
+						const double DistanceSq = FVector::DistSquared(Location, Position);
+						if (DistanceSq <= RadiusSq)
+						{
+							Func(SortedItems[SortedIndex], Position, DistanceSq);
+						}
+					}
+				}
+			}
+		}
+	}
+
+private:
+	FIntVector GetCellCoord(const FVector& Location) const
+	{
+		return FIntVector(
+			FMath::FloorToInt32(Location.X * InvCellSize),
+			FMath::FloorToInt32(Location.Y * InvCellSize),
+			FMath::FloorToInt32(Location.Z * InvCellSize));
+	}
+
+	// 축별 큰 소수를 곱해 섞는다 (Teschner et al.)
+	uint32 HashCell(int32 X, int32 Y, int32 Z) const
+	{
+		return ((static_cast<uint32>(X) * 73856093u) ^ (static_cast<uint32>(Y) * 19349663u) ^ (static_cast<uint32>(Z) * 83492791u)) & BucketMask;
+	}
+
+	double InvCellSize = 0.0;
+	uint32 BucketMask = 0;
+
+	// 입력 순서의 버킷 키
+	TArray<uint32> ItemBuckets;
+
+	// 버킷별 정렬 배열 구간 [BucketStart[B], BucketStart[B + 1])
+	TArray<int32> BucketStart;
+	TArray<int32> WriteCursor;
+
+	// 버킷 순으로 정렬한 원래 인덱스와 위치
+	TArray<int32> SortedItems;
+	TArray<FVector> SortedPositions;
+};
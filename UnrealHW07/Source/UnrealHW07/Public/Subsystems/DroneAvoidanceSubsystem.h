@@ -0,0 +1,91 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Physics/DroneSpatialHash.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DroneAvoidanceSubsystem.generated.h"
+
+class UDroneMovementComponent;
+
+/**
+ * 드론 간 분리/예측 회피.
+ * 매 프레임 끝에 등록된 드론 위치로 공간 해시를 다시 만들고, 드론마다 이웃만 훑어 조향 속도를 병렬로 구한 뒤
+ * 각 이동 컴포넌트에 넘긴다 (다음 프레임 이동에 섞이므로 1프레임 지연).
+ * 둘 다 조향을 받는 비행 중인 드론끼리만 이동 스윕에서 서로 무시하고 (SteeredDroneChannel 로 옮김), 그 접촉은 스윕 대신 이 조향으로 해소된다.
+ * 원격 플레이어가 조종하는 드론은 클라이언트 예측과 어긋나지 않도록 조향을 받지 않으므로 Pawn 채널에 남아 모든 드론을 막는다.
+ * 클라이언트에서는 등록하지 않으므로 충돌 설정도 바꾸지 않는다.
+ */
+UCLASS(Config = Game)
+class UNREALHW07_API UDroneAvoidanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem 오버라이드
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject 오버라이드
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 조향을 받는 드론의 오브젝트 채널 (DefaultEngine.ini 의 SteeredDrone). 이 채널끼리만 서로 무시한다
+	static constexpr ECollisionChannel SteeredDroneChannel = ECC_GameTraceChannel1;
+
+	// 등록 관리 (클라이언트에서는 등록하지 않는다). 해제하면 충돌 설정도 되돌린다
+	void RegisterDrone(UDroneMovementComponent* Drone);
+	void UnregisterDrone(UDroneMovementComponent* Drone);
+
+	// 드론을 SteeredDroneChannel 로 옮기거나 원래 채널로 되돌린다 (비행 기록 재생도 기록된 상태를 이걸로 맞춘다)
+	static void SetDroneSweepsIgnored(UDroneMovementComponent* Drone, bool bIgnore);
+
+	bool IsAvoidanceEnabled() const;
+
+private:
+	// 조향 대상 여부가 바뀐 드론의 스윕 무시 상태를 맞춘다 (bEnabled 가 false 면 모두 되돌림)
+	void UpdateSweepCollision(bool bEnabled);
+	void GatherState(float DeltaTime);
+	void ComputeSteering();
+	void ApplySteering();
+
+	// 이웃 질의 반경이자 공간 해시 셀 크기
+	UPROPERTY(Config)
+	float NeighborRadius = 600.f;
+
+	UPROPERTY(Config)
+	float SeparationRadius = 250.f;
+
+	UPROPERTY(Config)
+	float SeparationStrength = 400.f;
+
+	UPROPERTY(Config)
+	float AvoidanceRadius = 150.f;
+
+	UPROPERTY(Config)
+	float LookAheadTime = 1.f;
+
+	UPROPERTY(Config)
+	float AvoidanceStrength = 300.f;
+
+	UPROPERTY(Config)
+	float MaxAvoidanceSpeed = 600.f;
+
+	// 조향을 받는 드론끼리 이동 스윕에서 무시
+	UPROPERTY(Config)
+	bool bIgnoreDroneSweeps = true;
+
+	// 등록된 컴포넌트와 같은 인덱스의 상태
+	UPROPERTY()
+	TArray<UDroneMovementComponent*> Drones;
+
+	TArray<FVector> Positions;
+	TArray<FVector> PreviousPositions;
+	TArray<FVector> Velocities;
+	TArray<FVector> Steering;
+
+	FDroneSpatialHash SpatialHash;
+	bool bSteeringApplied = false;
+};
@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Controllers/DroneBotController.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DroneBotLoadTestSubsystem.generated.h"
+
+class APawn;
+
+/**
+ * 봇 부하 테스트 (장시간 소크 테스트).
+ * ADroneBotController 가 조종하는 드론 N 대를 스폰해 Enhanced Input 주입 → 입력 핸들러 → 이동 컴포넌트의 실제 경로로 구동하고,
+ * ReportInterval 마다 처리량(봇 갱신/초, 주입 액션/초)과 프레임/게임 스레드/이동 Tick 시간 통계를 로그와 CSV 에 한 줄씩 남긴다.
+ * 헤드리스 실행 예:
+ *   UnrealHW07Server /Game/Maps/MainMap -unattended -DroneBots=1000 -DroneBotProfile=Mixed -DroneBotDuration=14400
+ * 게임 중에는 drone.Bots.Start / drone.Bots.Stop 콘솔 명령을 쓴다. UDroneFleetPerfSubsystem 과 같은 카운터를 쓰므로 동시에 돌리지 않는다.
+ */
+UCLASS(Config = Game)
+class UNREALHW07_API UDroneBotLoadTestSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem 오버라이드
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject 오버라이드
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 프로필이 비어 있으면 봇마다 모든 행동을 돌아가며 배정 (Mixed). Duration <= 0 이면 Stop 까지 계속
+	void StartRun(int32 NumBots, TOptional<EDroneBotBehavior> Profile, double DurationSeconds, bool bInQuitWhenDone);
+	void StopRun();
+	bool IsRunning() const { return bRunning; }
+
+private:
+	void SpawnBots(int32 NumBots, TOptional<EDroneBotBehavior> Profile);
+	void DestroyBots();
+	void WriteReport();
+
+	// 스폰할 드론 클래스 (비어 있으면 ADronePawn)
+	UPROPERTY(Config)
+	TSoftClassPtr<APawn> BotPawnClass;
+
+	UPROPERTY(Config)
+	float SpawnSpacing = 600.f;
+
+	UPROPERTY(Config)
+	float SpawnHeight = 200.f;
+
+	// 통계 한 줄을 남기는 간격 (초)
+	UPROPERTY(Config)
+	float ReportInterval = 60.f;
+
+	UPROPERTY()
+	TArray<ADroneBotController*> Bots;
+
+	UPROPERTY()
+	TArray<APawn*> BotPawns;
+
+	bool bRunning = false;
+	bool bQuitWhenDone = false;
+	double RunStartSeconds = 0.0;
+	double RunDuration = 0.0;
+	double LastTickSeconds = 0.0;
+	double IntervalStartSeconds = 0.0;
+	FString CsvFilename;
+	FString ProfileLabel;
+
+	// 보고 구간 누적값
+	TArray<double> FrameTimesMs;
+	double GameThreadMsSum = 0.0;
+	double MovementMsSum = 0.0;
+	int64 BotUpdates = 0;
+};
@@ -0,0 +1,165 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DroneStats.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DroneFleetPerfSubsystem.generated.h"
+
+class APawn;
+class UDroneMovementComponent;
+
+/**
+ * 플릿 성능 측정용 프레임 카운터 (게임 스레드 전용).
+ * 이동/카메라 경로가 DRONE_FLEET_PERF_* 매크로로 누적하고 UDroneFleetPerfSubsystem 이 프레임마다 읽고 비운다.
+ * Shipping 빌드에서는 매크로가 비어 항상 0 이다.
+ */
+struct UNREALHW07_API FDroneFleetPerfCounters
+{
+	static uint64 MovementCycles;
+	static uint64 CameraCycles;
+	static int32 GroundTraces;
+
+	static void Reset()
+	{
+		MovementCycles = 0;
+		CameraCycles = 0;
+		GroundTraces = 0;
+	}
+};
+
+// 스코프 동안의 사이클을 지정한 카운터에 더한다
+struct FDroneFleetPerfScope
+{
+	explicit FDroneFleetPerfScope(uint64& InCounter)
+		: Counter(InCounter)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FDroneFleetPerfScope()
+	{
+		Counter += FPlatformTime::Cycles64() - StartCycles;
+	}
+
+private:
+	uint64& Counter;
+	uint64 StartCycles;
+};
+
+#if DRONE_STATS
+
+// 스코프 동안의 사이클을 FDroneFleetPerfCounters::Counter 에 더한다
+#define DRONE_FLEET_PERF_SCOPE(Counter) FDroneFleetPerfScope PREPROCESSOR_JOIN(DroneFleetPerfScope_, __LINE__)(FDroneFleetPerfCounters::Counter)
+
+#define DRONE_FLEET_PERF_INC(Counter) ++FDroneFleetPerfCounters::Counter
+
+#else
+
+#define DRONE_FLEET_PERF_SCOPE(Counter)
+#define DRONE_FLEET_PERF_INC(Counter)
+
+#endif
+
+/**
+ * 무인 플릿 성능 측정.
+ * 드론 N 대를 스폰해 스크립트 입력(추력/이동 패턴)으로 구동하고, 프레임 시간/게임 스레드 시간/이동 Tick 시간/
+ * 프레임당 트레이스 수/드론당 메모리/드론당 컴포넌트 수와 크기/드론당 스폰 시간을 CSV 로 남긴다. GPU 없는 리눅스 머신에서 다음처럼 실행한다.
+ *   UnrealEditor-Cmd UnrealHW07.uproject /Game/Maps/MainMap -game -nullrhi -unattended -benchmark -DronePerf=1,100,1000,5000
+ * 외형/카메라 컴포넌트를 뺀 데디케이티드 서버와 비교하려면 쿡한 UnrealHW07Server 를 같은 인자로 실행한다 (Target 열로 구분).
+ *   UnrealHW07Server /Game/Maps/MainMap -unattended -benchmark -DronePerf=1,100,1000,5000
+ * 게임 중에는 drone.Perf.Run 콘솔 명령으로도 시작할 수 있다. Shipping 빌드에서는 만들지 않는다.
+ */
+UCLASS(Config = Game)
+class UNREALHW07_API UDroneFleetPerfSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem 오버라이드
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject 오버라이드
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 측정 시작 (진행 중이면 무시)
+	void StartRun(const TArray<int32>& InFleetSizes, int32 InMeasureFrames, bool bInQuitWhenDone);
+	bool IsRunning() const { return Phase != EPhase::Idle; }
+
+	// 마지막으로 쓴 CSV 경로 (아직 없으면 빈 문자열)
+	const FString& GetLastCsvFilename() const { return LastCsvFilename; }
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		WarmUp,
+		Measure,
+		CoolDown
+	};
+
+	static constexpr int32 CoolDownFrames = 2;
+
+	struct FFrameSample
+	{
+		double FrameMs = 0.0;
+		// GGameThreadTime 은 한 프레임 늦게 갱신되므로 다음 Tick 에서 채운다 (채워지기 전에는 음수)
+		double GameThreadMs = -1.0;
+		double MovementMs = 0.0;
+		double CameraMs = 0.0;
+		int32 GroundTraces = 0;
+	};
+
+	void BeginFleet();
+	void EndFleet();
+	void FinishRun();
+	void DriveFleet();
+	void WriteCsv();
+
+	// 스폰할 드론 클래스 (비어 있으면 ADronePawn)
+	UPROPERTY(Config)
+	TSoftClassPtr<APawn> DroneClass;
+
+	UPROPERTY(Config)
+	int32 WarmUpFrames = 60;
+
+	UPROPERTY(Config)
+	float SpawnSpacing = 300.f;
+
+	UPROPERTY(Config)
+	float SpawnHeight = 1000.f;
+
+	UPROPERTY()
+	TArray<APawn*> SpawnedDrones;
+
+	UPROPERTY()
+	TArray<UDroneMovementComponent*> SpawnedMovement;
+
+	EPhase Phase = EPhase::Idle;
+	TArray<int32> FleetSizes;
+	int32 FleetIndex = 0;
+	int32 MeasureFrames = 300;
+	int32 PhaseFrame = 0;
+	bool bQuitWhenDone = false;
+
+	double LastTickSeconds = 0.0;
+	double ScriptTime = 0.0;
+	uint64 MemoryBeforeSpawn = 0;
+	uint64 MemoryAfterWarmUp = 0;
+	double SpawnSeconds = 0.0;
+
+	// 스폰 직후 드론당 컴포넌트 수와 컴포넌트 객체 크기 (서버에서 빠지는 외형 컴포넌트 비교용)
+	double ComponentsPerDrone = 0.0;
+	double ComponentKBPerDrone = 0.0;
+
+	TArray<FFrameSample> Samples;
+
+	// 플릿 크기별 결과 (CSV 한 줄씩)
+	TArray<FString> ResultRows;
+	FString LastCsvFilename;
+};
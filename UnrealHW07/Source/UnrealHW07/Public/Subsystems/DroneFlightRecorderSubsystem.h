@@ -0,0 +1,150 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Movement/DroneMovementComponent.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DroneFlightRecorderSubsystem.generated.h"
+
+class APawn;
+class FDroneFlightLogWriter;
+
+// 재생을 이어가는 데 필요한 시뮬레이션 상태 (키프레임)
+struct FDroneFlightKeyframe
+{
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	float ZVelocity = 0.f;
+	EDroneMovementMode MovementMode = EDroneMovementMode::Grounded;
+	bool bElevating = false;
+
+	// 고정 스텝 상태 (보간 비율과 마지막 스텝 이동량, 스텝 전까지 들고 가는 입력)
+	float FixedStepAccumulator = 0.f;
+	float InterpolationAlpha = 0.f;
+	float LastStepOffsetZ = 0.f;
+	FVector LastStepHorizontalOffset = FVector::ZeroVector;
+	float ThrustAxis = 0.f;
+	FVector2D PendingMoveInput = FVector2D::ZeroVector;
+
+	// 지면 프로브 상태 (비동기 감지는 다음 프레임에 소비할 요청 위치/길이까지)
+	float CachedGroundDistance = 0.f;
+	bool bGroundProbeHit = false;
+	FVector LastGroundProbeLocation = FVector::ZeroVector;
+	bool bGroundTracePending = false;
+	FVector PendingGroundProbeLocation = FVector::ZeroVector;
+	float PendingGroundProbeLength = 0.f;
+
+	friend FArchive& operator<<(FArchive& Ar, FDroneFlightKeyframe& Keyframe);
+};
+
+// 재생 결과 (키프레임과의 차이)
+struct FDroneFlightReplayResult
+{
+	int32 Drones = 0;
+	int64 Frames = 0;
+	int64 KeyframesChecked = 0;
+	int64 DivergentKeyframes = 0;
+	int32 ModeMismatches = 0;
+	double MaxLocationError = 0.0;
+	float MaxZVelocityError = 0.f;
+	double RecordedSeconds = 0.0;
+	double WallSeconds = 0.0;
+};
+
+/**
+ * 드론 비행 기록기와 결정적 재생.
+ * 기록: 개별 Tick(SimulateFrame)과 배치 경로(GroundPass → FinishSimFrame) 모두 소비한 입력 명령(이동/시선/상승/롤, 프레임 시간)과 그 프레임의 회피 조향/스윕 무시 상태를,
+ * KeyframeInterval 프레임마다 상태 키프레임(트랜스폼, CurrentZVelocity, 이동 모드, 고정 스텝/보간 상태, 지면 프로브 상태)을 압축 바이너리로 남긴다.
+ * 게임 스레드는 프레임 버퍼에 직렬화만 하고, 파일 쓰기는 백그라운드 스레드가 한다.
+ * 재생: 로그를 메모리 매핑해 드론을 스폰하고 Tick 없이 기록된 입력으로 SimulateFrame 을 연속 호출한다 (실시간보다 빠름).
+ * 비동기 지면 감지 드론은 기록된 모드를 그대로 쓰고, 요청 시 동기 트레이스한 결과를 다음 프레임에 소비해 같은 한 프레임 지연을 재현한다.
+ * 키프레임마다 재생 상태와 비교해 어긋남을 보고하고, 결과는 빌드 간 비교용 CSV 에 한 줄씩 쌓인다.
+ * 비동기 물리 드론은 물리 스레드에서 적분하므로 기록하지 않고, 처음 건너뛸 때 경고한다.
+ */
+UCLASS(Config = Game)
+class UNREALHW07_API UDroneFlightRecorderSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem 오버라이드
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	bool StartRecording(const FString& Filename);
+	void StopRecording();
+	bool IsRecording() const { return Writer.IsValid(); }
+
+	// 기록 (UDroneMovementComponent 가 호출)
+	void RecordFrame(const UDroneMovementComponent* Drone, const FDroneInputCommand& Command, float DeltaTime, float CatchUpTime);
+	void RecordPostFrame(const UDroneMovementComponent* Drone);
+	void RecordReset(const UDroneMovementComponent* Drone);
+	void RecordDespawn(const UDroneMovementComponent* Drone);
+	void RecordSkipped(const UDroneMovementComponent* Drone);
+
+	// 로그 전체를 재생 (기록 중에는 불가). bResyncOnKeyframe 이면 키프레임마다 상태를 맞춰 구간별 어긋남만 본다
+	bool Replay(const FString& Filename, bool bResyncOnKeyframe, FDroneFlightReplayResult& OutResult);
+
+private:
+	enum class ERecordType : uint8
+	{
+		Spawn,
+		Frame,
+		Keyframe,
+		Reset,
+		Despawn
+	};
+
+	struct FRecordedDrone
+	{
+		uint32 Id = 0;
+		int32 FramesSinceKeyframe = 0;
+	};
+
+	struct FReplayDrone
+	{
+		APawn* Pawn = nullptr;
+		UDroneMovementComponent* Movement = nullptr;
+		double SimSeconds = 0.0;
+	};
+
+	static FDroneFlightKeyframe CaptureKeyframe(const UDroneMovementComponent* Drone);
+	static void ApplyKeyframe(UDroneMovementComponent* Drone, const FDroneFlightKeyframe& Keyframe);
+
+	// 처음 보는 드론이면 스폰 레코드부터 쓴다
+	FRecordedDrone& FindOrAddRecordedDrone(const UDroneMovementComponent* Drone);
+	void WriteKeyframe(ERecordType Type, uint32 Id, const UDroneMovementComponent* Drone);
+	void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	void WriteReplayCsv(const FString& Filename, const FDroneFlightReplayResult& Result) const;
+
+	// 상태 키프레임 간격 (드론별 프레임 수)
+	UPROPERTY(Config)
+	int32 KeyframeInterval = 30;
+
+	// 이 이상 차이 나는 키프레임을 어긋남으로 센다
+	UPROPERTY(Config)
+	float ReplayLocationTolerance = 1.f;
+
+	UPROPERTY(Config)
+	float ReplayZVelocityTolerance = 1.f;
+
+	TSharedPtr<FDroneFlightLogWriter> Writer;
+	FString RecordingFilename;
+
+	// 이번 프레임 레코드 (프레임 끝에 통째로 기록 스레드에 넘긴다)
+	TArray<uint8> FrameBuffer;
+
+	TMap<const UDroneMovementComponent*, FRecordedDrone> RecordedDrones;
+	uint32 NextDroneId = 1;
+
+	// 기록할 수 없어 건너뛴 드론 (경고는 드론당 한 번)
+	TSet<const UDroneMovementComponent*> SkippedDrones;
+
+	bool bReplaying = false;
+
+	FDelegateHandle PostActorTickHandle;
+};
@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DroneHeightFieldSubsystem.generated.h"
+
+class FDroneHeightField;
+
+/**
+ * 현재 맵에 대해 베이크된 지면 높이 캐시를 메모리 맵으로 로드해 드론들과 공유한다.
+ * 베이크 파일이 없으면 드론은 기존 트레이스 경로를 그대로 사용한다.
+ */
+UCLASS()
+class UNREALHW07_API UDroneHeightFieldSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem 오버라이드
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	TSharedPtr<const FDroneHeightField> GetHeightField() const { return HeightField; }
+
+private:
+	TSharedPtr<const FDroneHeightField> HeightField;
+};
@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DroneInputLatencySubsystem.generated.h"
+
+class UDroneMovementComponent;
+
+/**
+ * 입력 → 동작 지연 측정.
+ * 기준 시각은 Enhanced Input 콜백이 이번 프레임 처음 FDroneInputCommand 를 기록한 시각(SampleTime)이다.
+ * - Motion: 그 입력으로 생긴 이동/회전이 루트 컴포넌트에 커밋된 시각 (UDroneMovementComponent::CommitPendingMove)
+ * - Camera: 로컬 플레이어의 뷰 타깃 드론이라면, 같은 프레임에 카메라 매니저 갱신까지 끝난 시각 (OnWorldPostActorTick)
+ * 최근 WindowSize 개 샘플의 백분위를 drone.Latency.Report 콘솔 명령과 CSV 프로파일러(Drone 카테고리)로 보고한다.
+ */
+UCLASS(Config = Game)
+class UNREALHW07_API UDroneInputLatencySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem 오버라이드
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// 입력으로 생긴 트랜스폼 변화가 루트 컴포넌트에 커밋됨
+	void RecordMotion(const UDroneMovementComponent* Drone, double SampleTime);
+
+	void ResetWindows();
+	void LogReport() const;
+
+private:
+	// 최근 샘플 링 버퍼 (ms)
+	struct FLatencyWindow
+	{
+		TArray<float> SamplesMs;
+		int32 NextIndex = 0;
+
+		void Add(float LatencyMs, int32 Capacity);
+		void Reset();
+	};
+
+	void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+	void LogWindow(const TCHAR* StageName, const FLatencyWindow& Window) const;
+
+	// 슬라이딩 윈도우 크기 (스테이지별 샘플 수)
+	UPROPERTY(Config)
+	int32 WindowSize = 512;
+
+	// 이보다 오래된 입력은 동작으로 이어지지 않은 것으로 보고 버린다 (초)
+	UPROPERTY(Config)
+	float MaxTrackedLatency = 1.f;
+
+	// 응답성 목표 (ms), 리포트에 초과 비율을 함께 출력
+	UPROPERTY(Config)
+	float LatencyBudgetMs = 50.f;
+
+	FLatencyWindow MotionWindow;
+	FLatencyWindow CameraWindow;
+
+	// 이번 프레임에 루트까지 반영되어 카메라 갱신을 기다리는 입력 시각 (뷰 타깃 드론만)
+	TArray<double> PendingCameraSampleTimes;
+
+	FDelegateHandle PostActorTickHandle;
+};
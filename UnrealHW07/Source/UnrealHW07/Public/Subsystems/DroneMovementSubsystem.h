@@ -0,0 +1,83 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DroneMovementSubsystem.generated.h"
+
+class UDroneMovementComponent;
+class FDroneAsyncPhysicsCallback;
+
+/**
+ * 배치 모드 드론들의 이동을 한 번에 처리하는 월드 서브시스템.
+ * 수직 물리 상태와 파라미터를 SoA로 보관하고, 추력/중력/클램프를 병렬 벡터 루프로 (드론별 서브스텝 포함) 적분한 뒤 트랜스폼을 한 번에 반영한다.
+ * 비동기 물리 모드 드론은 Chaos 콜백과 입력/결과를 주고받기만 한다.
+ */
+UCLASS()
+class UNREALHW07_API UDroneMovementSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem 오버라이드
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject 오버라이드
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 등록 관리
+	void RegisterDrone(UDroneMovementComponent* Drone);
+	void UnregisterDrone(UDroneMovementComponent* Drone);
+	int32 GetNumDrones() const { return Drones.Num(); }
+
+	bool RegisterAsyncPhysicsDrone(UDroneMovementComponent* Drone);
+	void UnregisterAsyncPhysicsDrone(UDroneMovementComponent* Drone);
+
+private:
+	// 배치 단계
+	int32 GatherState();
+	void IntegrateBatch(int32 MaxSteps);
+	void CommitTransforms();
+
+	void RemoveSlot(int32 Index);
+
+	// 등록을 해제할 때 개별 Tick 을 되살린다 (잠든/반납된 드론 제외)
+	static void RestoreComponentTick(UDroneMovementComponent* Drone);
+
+	// 비동기 물리 모드: 결과 반영 → 입력 소비/지면 프로브 → 다음 입력 전송
+	void TickAsyncPhysicsDrones(float DeltaTime);
+
+	// 등록된 컴포넌트 (인덱스 = SoA 슬롯)
+	UPROPERTY()
+	TArray<UDroneMovementComponent*> Drones;
+
+	// 이번 프레임 드론별 갱신 시간 (중요도 LOD 로 건너뛰면 0)
+	TArray<float> FrameDeltaTime;
+
+	// SoA 상태
+	TArray<float> ZVelocity;
+	TArray<float> FlyingMask;
+	TArray<float> PendingThrust;
+	TArray<float> StepDeltaTime;
+	TArray<float> NumSteps;
+	TArray<float> DeltaZ;
+	TArray<float> LastStepOffsetZ;
+
+	// SoA 파라미터 (GatherState 에서 매 프레임 컴포넌트 값으로 갱신)
+	TArray<float> GravityZ;
+	TArray<float> MaxFallingSpeed;
+	TArray<float> MaxAscendingSpeed;
+	TArray<float> ThrustAccelZ;
+
+	// 비동기 물리 모드
+	FDroneAsyncPhysicsCallback* AsyncPhysicsCallback = nullptr;
+
+	UPROPERTY()
+	TMap<uint32, UDroneMovementComponent*> AsyncPhysicsDrones;
+
+	TArray<uint32> RemovedAsyncPhysicsDroneIds;
+	uint32 NextAsyncPhysicsDroneId = 1;
+};
@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DronePoolSubsystem.generated.h"
+
+class ADronePawn;
+
+// 클래스별 대기 중인 드론
+USTRUCT()
+struct FDronePoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<ADronePawn*> Free;
+};
+
+/**
+ * 드론 액터 풀.
+ * 반납된 드론은 파괴 대신 숨겨서 보관했다가 다시 꺼낼 때 상태만 되돌린다
+ * (컴포넌트 등록, BeginPlay 델리게이트 바인딩, 서브시스템 배치 등록은 그대로 재사용).
+ * 미리 채우는 것은 실제로 꺼내 쓸 쪽 (군집 스폰, drone.Pool.Prewarm) 이 필요한 만큼만 하고, 시작 시 PrewarmCount 는 기본 0 이다.
+ * 풀 적중률과, 적중/미스 각각 실제로 꺼내는 데 걸린 시간을 측정해 drone.Pool.Stats 로 보고한다. 서버/스탠드얼론 전용.
+ */
+UCLASS(Config = Game)
+class UNREALHW07_API UDronePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem 오버라이드
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// 풀에서 꺼내고, 비었으면 새로 스폰. PawnClass 가 null 이면 기본 DroneClass
+	ADronePawn* AcquireDrone(UClass* PawnClass, const FVector& Location, const FRotator& Rotation);
+
+	// 풀에 반납 (클래스별 최대 수를 넘으면 파괴)
+	void ReleaseDrone(ADronePawn* Drone);
+
+	void Prewarm(UClass* PawnClass, int32 Count);
+	int32 GetNumPooled(UClass* PawnClass) const;
+
+	void LogStats() const;
+
+private:
+	// PawnClass 가 null 이면 기본 클래스 (서버에서 처음 필요할 때 로드). 클라이언트에서는 null
+	UClass* ResolveClass(UClass* PawnClass);
+	ADronePawn* SpawnDrone(UClass* PawnClass, const FVector& Location, const FRotator& Rotation);
+
+	// 기본 드론 클래스 (비어 있으면 ADronePawn). 다른 클래스를 넘기는 호출자만 있는 월드에서는 로드하지 않는다
+	UPROPERTY(Config)
+	TSoftClassPtr<ADronePawn> DroneClass;
+
+	// 시작 시 미리 스폰할 수 (미리 스폰한 드론도 BeginPlay/폰 데이터 로드/초기 복제 비용을 치르므로 기본은 0)
+	UPROPERTY(Config)
+	int32 PrewarmCount = 0;
+
+	UPROPERTY(Config)
+	int32 MaxPooledPerClass = 512;
+
+	// 대기 중인 드론을 둘 위치 (보이지 않고 아무것과도 겹치지 않는 곳)
+	UPROPERTY(Config)
+	FVector PoolLocation = FVector(0.0, 0.0, -100000.0);
+
+	UPROPERTY()
+	UClass* DefaultClass = nullptr;
+
+	UPROPERTY()
+	TMap<UClass*, FDronePoolBucket> Buckets;
+
+	// 통계 (적중/미스 시간은 AcquireDrone 전체 시간, 미리 채운 스폰은 따로 센다)
+	int64 Acquires = 0;
+	int64 Hits = 0;
+	int64 Releases = 0;
+	int64 Overflows = 0;
+	int64 PrewarmSpawns = 0;
+	double HitSeconds = 0.0;
+	double MissSeconds = 0.0;
+	double PrewarmSeconds = 0.0;
+};
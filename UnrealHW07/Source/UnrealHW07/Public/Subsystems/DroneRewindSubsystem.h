@@ -0,0 +1,139 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/Movement/DroneMovementComponent.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DroneRewindSubsystem.generated.h"
+
+class UPrimitiveComponent;
+struct FBodyInstance;
+
+// 한 시점의 드론 상태 (서버 월드 시간 기준)
+struct FDroneRewindSample
+{
+	double Time = 0.0;
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	EDroneMovementMode MovementMode = EDroneMovementMode::Grounded;
+};
+
+// 되감은 충돌 구와 선분의 교차 결과
+struct FDroneRewindHit
+{
+	UDroneMovementComponent* Drone = nullptr;
+	FVector Location = FVector::ZeroVector;
+
+	// 선분 위 비율 [0, 1]
+	float Fraction = 1.f;
+};
+
+/**
+ * 서버 측 되감기 버퍼 (지연 보상용).
+ * 드론마다 등록 시 MaxRewindTime * SampleRate 크기의 링 버퍼를 한 번 할당하고, 액터 Tick 이 끝난 뒤 SampleRate 간격으로 트랜스폼/이동 모드를 기록한다.
+ * 프레임 수가 아니라 시간 간격으로 기록하므로 서버 프레임레이트와 무관하게 버퍼가 MaxRewindTime 을 덮는다.
+ * 마지막 샘플 이후 시각은 현재 트랜스폼과 보간한다.
+ * 움직이지 않은 드론은 기록을 건너뛰므로 잠든 드론은 비교 한 번만 든다.
+ * 조회와 되감기는 호출자가 넘긴 드론만 다루므로 비용은 플릿 크기가 아니라 조회 대상 수에 비례한다.
+ */
+UCLASS(Config = Game)
+class UNREALHW07_API UDroneRewindSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem 오버라이드
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	void RegisterDrone(UDroneMovementComponent* Drone);
+	void UnregisterDrone(UDroneMovementComponent* Drone);
+
+	// 요청 시각을 [현재 - MaxRewindTime, 현재] 로 제한 (클라이언트가 보낸 시각을 그대로 믿지 않는다)
+	double ClampRewindTime(double Time) const;
+
+	// 과거 시각의 상태 (샘플 사이는 보간). 기록이 없으면 false
+	bool GetStateAtTime(const UDroneMovementComponent* Drone, double Time, FDroneRewindSample& OutSample) const;
+
+	// 후보 드론들의 과거 충돌 구와 선분 교차 중 가장 가까운 것. 물리 씬은 건드리지 않는다
+	bool LineTraceRewound(const FVector& Start, const FVector& End, double Time, TConstArrayView<UDroneMovementComponent*> Candidates, FDroneRewindHit& OutHit) const;
+
+	int32 GetHistorySize() const { return HistorySize; }
+	float GetSampleRate() const { return SampleRate; }
+	float GetMaxRewindTime() const { return MaxRewindTime; }
+
+private:
+	// 고정 크기 링 버퍼 (오래된 것부터 시간순)
+	struct FHistory
+	{
+		UDroneMovementComponent* Drone = nullptr;
+		UPrimitiveComponent* Collision = nullptr;
+		float CollisionRadius = 0.f;
+
+		TArray<FDroneRewindSample> Samples;
+		int32 Head = 0;
+		int32 Num = 0;
+
+		// 마지막 기록이 직전 프레임이 아니면 멈춰 있던 상태를 이어 붙여야 한다
+		double LastObservedTime = 0.0;
+
+		const FDroneRewindSample& Get(int32 Index) const { return Samples[(Head + Index) % Samples.Num()]; }
+		void Push(const FDroneRewindSample& Sample);
+	};
+
+	void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+	void RecordHistory(FHistory& History, double Now);
+
+	const FHistory* FindHistory(const UDroneMovementComponent* Drone) const;
+
+	// 초당 기록 횟수 (드론당 메모리 상한 = HistorySize * sizeof(FDroneRewindSample))
+	UPROPERTY(Config)
+	float SampleRate = 60.f;
+
+	// 되감을 수 있는 최대 시간 (초)
+	UPROPERTY(Config)
+	float MaxRewindTime = 0.5f;
+
+	// 드론당 샘플 수 (MaxRewindTime 과 SampleRate 로 Initialize 에서 정한다)
+	int32 HistorySize = 0;
+
+	// 다음 기록 시각 (월드 시간)
+	double NextSampleTime = 0.0;
+
+	// 이 이하 변화는 움직이지 않은 것으로 본다
+	UPROPERTY(Config)
+	float RecordLocationTolerance = 0.1f;
+
+	TArray<FHistory> Histories;
+	TMap<const UDroneMovementComponent*, int32> HistoryIndices;
+
+	FDelegateHandle PostActorTickHandle;
+
+	friend struct FDroneRewindScope;
+};
+
+/**
+ * 스코프 동안 지정한 드론들의 충돌 바디를 과거 시각으로 옮긴다 (엔진 트레이스/스윕을 그대로 쓰는 판정용).
+ * 컴포넌트가 아니라 물리 바디만 옮기므로 TransformUpdated 가 불리지 않는다.
+ * 따라서 잠든 드론이 깨어나지 않고, 붙어 있는 외형 컴포넌트도 따라가지 않는다.
+ * 스코프가 끝나면 바디를 원래 트랜스폼으로 되돌린다.
+ */
+struct UNREALHW07_API FDroneRewindScope
+{
+	FDroneRewindScope(const UDroneRewindSubsystem& Subsystem, TConstArrayView<UDroneMovementComponent*> Drones, double Time);
+	~FDroneRewindScope();
+
+	FDroneRewindScope(const FDroneRewindScope&) = delete;
+	FDroneRewindScope& operator=(const FDroneRewindScope&) = delete;
+
+private:
+	struct FSavedTransform
+	{
+		FBodyInstance* Body;
+		FTransform Transform;
+	};
+
+	TArray<FSavedTransform, TInlineAllocator<16>> Saved;
+};
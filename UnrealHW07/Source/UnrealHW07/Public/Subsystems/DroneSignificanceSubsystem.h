@@ -0,0 +1,88 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DroneSignificanceSubsystem.generated.h"
+
+class UDroneCameraComponent;
+class UDroneMovementComponent;
+
+/** 중요도 단계별 갱신 예산 */
+USTRUCT()
+struct FDroneSignificanceTier
+{
+	GENERATED_BODY()
+
+	// 가장 가까운 시점과의 거리가 이 안이면 이 단계 (0 이하면 거리 제한 없음)
+	UPROPERTY(Config, EditAnywhere, meta = (ClampMin = "0", Units = "cm"))
+	float MaxDistance = 0.f;
+
+	// 이 단계에 둘 수 있는 최대 드론 수 (0 이면 무제한, 넘치는 드론은 다음 단계로)
+	UPROPERTY(Config, EditAnywhere, meta = (ClampMin = "0"))
+	int32 MaxDrones = 0;
+
+	// 이동 갱신 간격 (0 이면 매 프레임)
+	UPROPERTY(Config, EditAnywhere, meta = (ClampMin = "0", ClampMax = "1", Units = "s"))
+	float UpdateInterval = 0.f;
+
+	// 지면 프로브 최소 간격 (0 이면 제한 없음)
+	UPROPERTY(Config, EditAnywhere, meta = (ClampMin = "0", Units = "s"))
+	float GroundTraceInterval = 0.f;
+
+	// UDroneCameraComponent / 카메라 붐 갱신 여부
+	UPROPERTY(Config, EditAnywhere)
+	bool bCameraUpdates = false;
+};
+
+/**
+ * 시점(플레이어 카메라)과의 거리와 빙의 여부로 드론의 중요도 단계를 정하고,
+ * 단계별 예산에 맞춰 이동 갱신 간격, 지면 프로브 간격, 카메라 갱신을 조절한다.
+ * 플레이어가 조종하는 드론은 항상 첫 단계에 들어간다.
+ */
+UCLASS(Config = Game)
+class UNREALHW07_API UDroneSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem 오버라이드
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject 오버라이드
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 등록 관리
+	void RegisterDrone(UDroneMovementComponent* Drone);
+	void UnregisterDrone(UDroneMovementComponent* Drone);
+
+	// 다음 Tick 에서 바로 다시 평가 (빙의 변경 등)
+	void RequestEvaluation() { TimeUntilEvaluation = 0.f; }
+
+private:
+	void EvaluateSignificance();
+	void ApplyTier(int32 DroneIndex, int32 TierIndex);
+
+	// 단계 설정 (앞일수록 중요, 마지막 단계가 나머지를 모두 받는다)
+	UPROPERTY(Config)
+	TArray<FDroneSignificanceTier> Tiers;
+
+	// 재평가 간격
+	UPROPERTY(Config)
+	float EvaluationInterval = 0.25f;
+
+	// 등록된 드론과 같은 인덱스의 카메라 컴포넌트 / 현재 단계
+	UPROPERTY()
+	TArray<UDroneMovementComponent*> Drones;
+
+	UPROPERTY()
+	TArray<UDroneCameraComponent*> Cameras;
+
+	TArray<int32> TierIndices;
+
+	float TimeUntilEvaluation = 0.f;
+};
@@ -0,0 +1,157 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassArchetypeTypes.h"
+#include "MassEntityTypes.h"
+#include "Components/Movement/DroneMovementComponent.h"
+#include "Physics/DroneKinematics.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DroneSwarmSubsystem.generated.h"
+
+class ADronePawn;
+class FDroneHeightField;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+struct FMassEntityManager;
+struct FStreamableHandle;
+
+// 군집 프로세서가 한 프레임 동안 읽기만 하는 공용 입력 (서브시스템 Tick 에서 갱신)
+struct FDroneSwarmFrameData
+{
+	FDroneKinematicsParams Params;
+	TSharedPtr<const FDroneHeightField> HeightField;
+	TArray<FVector, TInlineAllocator<8>> ViewLocations;
+	double ScriptTime = 0.0;
+	// 승격할 드론 클래스의 스텝 방식 (가변 스텝이면 프레임 시간 한 스텝으로 적분)
+	bool bUseFixedTimestep = false;
+	float FixedStep = 1.f / 60.f;
+	int32 MaxSubsteps = 4;
+	float GroundProbeLength = 10.f;
+	float GroundReferenceZ = 0.f;
+	float CruiseSpeed = 300.f;
+	float TurnRate = 15.f;
+	float PromoteDistanceSq = 0.f;
+};
+
+// 에셋 로드가 끝나기 전에 요청된 스폰
+struct FDronePendingSwarmSpawn
+{
+	int32 Count = 0;
+	FVector Center = FVector::ZeroVector;
+	float Radius = 0.f;
+};
+
+/**
+ * 조종하지 않는 대규모 드론 군집.
+ * 드론은 ADronePawn 액터 대신 Mass 엔티티 (트랜스폼/비행 상태/인스턴스 슬롯 프래그먼트) 로 존재하고,
+ * UDroneSwarmFlightProcessor 가 병렬로 적분한 결과를 인스턴스드 스태틱 메시 하나로 그린다 (서버 타깃은 렌더링 생략).
+ * 플레이어 시점에 PromoteDistance 안으로 들어오거나 빙의할 드론은 같은 상태의 ADronePawn 으로 승격하고,
+ * 조종되지 않는 승격 드론에는 엔티티와 같은 비행 스크립트를 입력 명령으로 넣어 승격 전후 비행이 이어지고,
+ * 조종되지 않은 채 DemoteDistance 밖으로 나가면 같은 위상의 엔티티로 강등한다.
+ * 엔티티 아키타입/에셋/ISM 액터는 서버에서 군집을 처음 스폰할 때 비동기 로드 후 만든다.
+ */
+UCLASS(Config = Game)
+class UNREALHW07_API UDroneSwarmSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// USubsystem 오버라이드
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject 오버라이드
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Center 주변 Radius 안에 드론 Count 대를 엔티티로 스폰 (서버 전용. 첫 스폰은 에셋 로드가 끝난 뒤에 처리된다)
+	void SpawnSwarm(int32 Count, const FVector& Center, float Radius);
+	void ClearSwarm();
+
+	// Location 에 가장 가까운 군집 드론을 액터로 승격 (빙의용). 군집이 비었으면 null
+	ADronePawn* PromoteNearest(const FVector& Location);
+
+	int32 GetNumSwarmDrones() const { return InstanceEntities.Num(); }
+	int32 GetNumPromotedDrones() const { return PromotedDrones.Num(); }
+
+	const FDroneSwarmFrameData& GetFrameData() const { return FrameData; }
+
+private:
+	friend class UDroneSwarmFlightProcessor;
+
+	void RequestSwarmAssets();
+	void HandleSwarmAssetsLoaded();
+	bool EnsureInitialized();
+	void SpawnEntities(int32 Count, const FVector& Center, float Radius);
+	void UpdateFrameData(float DeltaTime);
+	void UpdateInstances();
+	void PromoteRequested();
+	void DemoteDistant();
+	void DrivePromoted(float DeltaTime);
+
+	// 생성된 엔티티의 프래그먼트를 채우고 인스턴스 슬롯을 붙인다. 슬롯 인덱스 반환
+	int32 AddEntity(FMassEntityHandle Entity, const FVector& Location, float Yaw, float ZVelocity, EDroneMovementMode MovementMode, float ScriptPhase);
+	void RemoveInstanceSlot(int32 InstanceIndex);
+	ADronePawn* PromoteInstance(int32 InstanceIndex);
+	void DemotePawn(ADronePawn* Pawn);
+	void RemovePromotedAt(int32 Index);
+
+	// 승격 시 스폰할 드론 클래스 (비어 있으면 ADronePawn). 비행 규칙 파라미터도 이 클래스 기본값에서 가져온다
+	UPROPERTY(Config)
+	TSoftClassPtr<ADronePawn> DroneClass;
+
+	// 군집 렌더링용 프록시 메시 (드론 메시는 스켈레탈이라 인스턴싱할 수 없다)
+	UPROPERTY(Config)
+	TSoftObjectPtr<UStaticMesh> SwarmMesh;
+
+	// 승격/강등 거리 (강등 거리가 더 멀어야 경계에서 반복하지 않는다)
+	UPROPERTY(Config)
+	float PromoteDistance = 3000.f;
+
+	UPROPERTY(Config)
+	float DemoteDistance = 5000.f;
+
+	// 동시에 액터로 존재할 수 있는 승격 드론 수
+	UPROPERTY(Config)
+	int32 MaxPromotedDrones = 64;
+
+	UPROPERTY(Config)
+	float CruiseSpeed = 300.f;
+
+	// 초당 선회 각도
+	UPROPERTY(Config)
+	float TurnRate = 15.f;
+
+	// 베이크된 높이맵이 없을 때 쓰는 지면 높이
+	UPROPERTY(Config)
+	float GroundReferenceZ = 0.f;
+
+	UPROPERTY()
+	UClass* PawnClass = nullptr;
+
+	UPROPERTY()
+	UInstancedStaticMeshComponent* SwarmInstances = nullptr;
+
+	UPROPERTY()
+	TArray<ADronePawn*> PromotedDrones;
+
+	// PromotedDrones 와 같은 인덱스의 스크립트 위상 (조종되지 않는 동안 엔티티와 같은 스크립트로 계속 날린다)
+	TArray<float> PromotedScriptPhases;
+
+	TSharedPtr<FStreamableHandle> SwarmAssetsHandle;
+	TArray<FDronePendingSwarmSpawn> PendingSpawns;
+
+	FMassEntityManager* EntityManager = nullptr;
+	FMassArchetypeHandle SwarmArchetype;
+
+	// 인스턴스 슬롯 (인덱스 = ISM 인스턴스 인덱스). 프로세서가 슬롯별로 트랜스폼/승격 요청을 쓴다
+	TArray<FMassEntityHandle> InstanceEntities;
+	TArray<FTransform> InstanceTransforms;
+	TArray<uint8> PromotionRequests;
+
+	FDroneSwarmFrameData FrameData;
+	FRandomStream Random;
+};
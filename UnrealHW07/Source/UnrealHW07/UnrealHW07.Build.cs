@@ -8,7 +8,7 @@ public class UnrealHW07 : ModuleRules
 	{
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 	
-		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "GameplayTags" });
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "GameplayTags", "Chaos", "PhysicsCore", "ReplicationGraph", "MassEntity" });
 
 		PrivateDependencyModuleNames.AddRange(new string[] {  });
 